@@ -4,12 +4,76 @@
  **/
 
 #include "asmgenerator.h"
+#include <cstdint>
 #include <iostream>
 #include <utility>
 
 
 namespace backend {
-ASMgenerator::ASMgenerator()
+
+static bool isIntConstant(ir::Value *value)
+{
+    return value->getType() == ir::Value::Type::CONSTANT && value->getDataType() == ir::Value::DataType::INT;
+}
+
+static int intConstant(ir::Value *value)
+{
+    return static_cast<ir::ConstantValue<int>*>(value)->getConstantValue();
+}
+
+static int log2Exact(uint32_t value)
+{
+    if (value == 0 || (value & (value - 1)) != 0)
+        return -1;
+
+    int log = 0;
+    while (value >>= 1)
+        log++;
+    return log;
+}
+
+// calls and string operations (runtime routines included) pass values in argument registers
+static bool usesParamRegisters(ir::Instruction *instr)
+{
+    if (dynamic_cast<ir::CallInstruction*>(instr))
+        return true;
+    std::vector<ir::Value*> values = ir::getInstructionOperands(instr);
+    if (ir::ResultInstruction *result = dynamic_cast<ir::ResultInstruction*>(instr))
+        values.push_back(result->getResult());
+    for (ir::Value *value : values){
+        if (value != nullptr && value->getDataType() == ir::Value::DataType::STRING)
+            return true;
+    }
+    return false;
+}
+
+// Magic number and shift for signed division by constant, see Hacker's Delight, 10-1
+static void signedDivisionMagic(int divisor, int32_t &magic, int &shift)
+{
+    const uint32_t two31 = 0x80000000u;
+    uint32_t ad = divisor < 0 ? -static_cast<uint32_t>(divisor) : divisor;
+    uint32_t t = two31 + (static_cast<uint32_t>(divisor) >> 31);
+    uint32_t anc = t - 1 - t % ad;
+    uint32_t q1 = two31 / anc, r1 = two31 - q1 * anc;
+    uint32_t q2 = two31 / ad, r2 = two31 - q2 * ad;
+    uint32_t delta;
+    int p = 31;
+    do {
+        p++;
+        q1 *= 2; r1 *= 2;
+        if (r1 >= anc){ q1++; r1 -= anc; }
+        q2 *= 2; r2 *= 2;
+        if (r2 >= ad){ q2++; r2 -= ad; }
+        delta = ad - r2;
+    } while (q1 < delta || (q1 == delta && r1 == 0));
+
+    magic = static_cast<int32_t>(q2 + 1);
+    if (divisor < 0)
+        magic = -magic;
+    shift = p - 32;
+}
+
+ASMgenerator::ASMgenerator(bool ropeStrings, bool delaySlots) : ropeStrings(ropeStrings), delaySlots(delaySlots)
 {
     //std::cout << "<< TODO:instructions check, void functions >>" << std::endl;
 }
@@ -21,6 +85,7 @@ ASMgenerator::~ASMgenerator()
 
 int ASMgenerator::translateIR(ir::Builder &builder){
 
+    effects.run(builder);
     for (auto& it : builder.getFunctions())
         it.second->accept(*this);
     return 0;
@@ -52,6 +117,17 @@ std::string ASMgenerator::getTargetCode()
            "	jr $ra"                             "\n"
            "\n";
     codeSize += 8*4;
+    // $3 holds $gp saved before call; string at the start of callee's heap is adopted
+    // by keeping callee's $gp, strings in caller's memory are used directly, others are copied
+    out << "$ADOPT_R2$:"                            "\n"
+           "	beq $2, $3, $ADOPT_R2_end$"         "\n"
+           "	move $gp, $3"                       "\n"
+           "	sltu $4, $2, $3"                    "\n"
+           "	beq $4, $0, $MOVE_R2_TO_GP$"        "\n"
+           "$ADOPT_R2_end$:"                       "\n"
+           "	jr $ra"                             "\n"
+           "\n";
+    codeSize += 5*4;
     out << "$STR_CMP$:"                      "\n"
            "	lb $6, 0($4)"                 "\n"
            "	lb $7, 0($5)"                 "\n"
@@ -68,12 +144,243 @@ std::string ASMgenerator::getTargetCode()
            "	jr $ra"                       "\n"
            "\n";
     codeSize += 12*4;
+    // $4 points into string, returns address of its terminator in $2
+    // aligned words are tested for zero byte at once using (w - 0x01010101) & ~w & 0x80808080
+    out << "$STR_LEN$:"                      "\n"
+           "	andi $3, $4, 3"               "\n"
+           "	beq $3, $0, $STR_LEN_words$"  "\n"
+           "	lb $3, 0($4)"                 "\n"
+           "	beq $3, $0, $STR_LEN_end$"    "\n"
+           "	addi $4, $4, 1"               "\n"
+           "	j $STR_LEN$"                  "\n"
+           "$STR_LEN_words$:"                "\n"
+           "	lui $6, 0x0101"               "\n"
+           "	ori $6, $6, 0x0101"           "\n"
+           "	sll $7, $6, 7"                "\n"
+           "$STR_LEN_loop$:"                 "\n"
+           "	lw $3, 0($4)"                 "\n"
+           "	subu $5, $3, $6"              "\n"
+           "	nor $3, $3, $0"               "\n"
+           "	and $5, $5, $3"               "\n"
+           "	and $5, $5, $7"               "\n"
+           "	bne $5, $0, $STR_LEN_bytes$"  "\n"
+           "	addi $4, $4, 4"               "\n"
+           "	j $STR_LEN_loop$"             "\n"
+           "$STR_LEN_bytes$:"                "\n"
+           "	lb $3, 0($4)"                 "\n"
+           "	beq $3, $0, $STR_LEN_end$"    "\n"
+           "	addi $4, $4, 1"               "\n"
+           "	j $STR_LEN_bytes$"            "\n"
+           "$STR_LEN_end$:"                  "\n"
+           "	move $2, $4"                  "\n"
+           "	jr $ra"                       "\n"
+           "\n";
+    codeSize += 23*4;
+    // $4 points into string, returns address of the first occurrence of char in $5
+    out << "$STR_SCAN$:"                     "\n"
+           "	lb $3, 0($4)"                 "\n"
+           "	beq $3, $5, $STR_SCAN_end$"   "\n"
+           "	addi $4, $4, 1"               "\n"
+           "	j $STR_SCAN$"                 "\n"
+           "$STR_SCAN_end$:"                 "\n"
+           "	move $2, $4"                  "\n"
+           "	jr $ra"                       "\n"
+           "\n";
+    codeSize += 6*4;
+    // same as $STR_SCAN$, but stops also at the terminator
+    out << "$STR_FIND$:"                     "\n"
+           "	lb $3, 0($4)"                 "\n"
+           "	beq $3, $5, $STR_FIND_end$"   "\n"
+           "	beq $3, $0, $STR_FIND_end$"   "\n"
+           "	addi $4, $4, 1"               "\n"
+           "	j $STR_FIND$"                 "\n"
+           "$STR_FIND_end$:"                 "\n"
+           "	move $2, $4"                  "\n"
+           "	jr $ra"                       "\n"
+           "\n";
+    codeSize += 7*4;
+    // $4 and $5 point into strings, returns address in the first one where they differ or end
+    out << "$STR_MISMATCH$:"                 "\n"
+           "	lb $6, 0($4)"                 "\n"
+           "	lb $7, 0($5)"                 "\n"
+           "	bne $6, $7, $STR_MISMATCH_end$" "\n"
+           "	beq $6, $0, $STR_MISMATCH_end$" "\n"
+           "	addi $4, $4, 1"               "\n"
+           "	addi $5, $5, 1"               "\n"
+           "	j $STR_MISMATCH$"             "\n"
+           "$STR_MISMATCH_end$:"             "\n"
+           "	move $2, $4"                  "\n"
+           "	jr $ra"                       "\n"
+           "\n";
+    codeSize += 9*4;
+    // $4 points into string, copies at most $5 chars (unsigned) to new string on heap returned in $2
+    out << "$SUBSTR$:"                       "\n"
+           "	move $2, $gp"                 "\n"
+           "$SUBSTR_loop$:"                  "\n"
+           "	beq $5, $0, $SUBSTR_end$"     "\n"
+           "	lb $3, 0($4)"                 "\n"
+           "	beq $3, $0, $SUBSTR_end$"     "\n"
+           "	sb $3, 0($gp)"                "\n"
+           "	addi $4, $4, 1"               "\n"
+           "	addi $gp, $gp, 1"             "\n"
+           "	addi $5, $5, -1"              "\n"
+           "	j $SUBSTR_loop$"              "\n"
+           "$SUBSTR_end$:"                   "\n"
+           "	sb $0, 0($gp)"                "\n"
+           "	addi $gp, $gp, 1"             "\n"
+           "	jr $ra"                       "\n"
+           "\n";
+    codeSize += 13*4;
+    if (ropeStrings){
+        // rope is a heap node {length, left, right} with address tagged by the highest bit,
+        // $4 and $5 are concatenated, returns flat string or tagged node in $2
+        out << "$ROPE_CAT$:"                       "\n"
+               "	move $2, $5"                    "\n"
+               "	bgez $4, $ROPE_CAT_left_flat$"  "\n"
+               "	sll $3, $4, 1"                  "\n"
+               "	srl $3, $3, 1"                  "\n"
+               "	lw $6, 0($3)"                   "\n"
+               "	j $ROPE_CAT_right$"             "\n"
+               "$ROPE_CAT_left_flat$:"             "\n"
+               "	move $3, $4"                    "\n"
+               "$ROPE_CAT_left_loop$:"             "\n"
+               "	lb $7, 0($3)"                   "\n"
+               "	beq $7, $0, $ROPE_CAT_left_end$" "\n"
+               "	addi $3, $3, 1"                 "\n"
+               "	j $ROPE_CAT_left_loop$"         "\n"
+               "$ROPE_CAT_left_end$:"              "\n"
+               "	sub $6, $3, $4"                 "\n"
+               "	beq $6, $0, $ROPE_CAT_end$"     "\n"
+               "$ROPE_CAT_right$:"                 "\n"
+               "	move $2, $4"                    "\n"
+               "	bgez $5, $ROPE_CAT_right_flat$" "\n"
+               "	sll $3, $5, 1"                  "\n"
+               "	srl $3, $3, 1"                  "\n"
+               "	lw $7, 0($3)"                   "\n"
+               "	j $ROPE_CAT_node$"              "\n"
+               "$ROPE_CAT_right_flat$:"            "\n"
+               "	move $3, $5"                    "\n"
+               "$ROPE_CAT_right_loop$:"            "\n"
+               "	lb $7, 0($3)"                   "\n"
+               "	beq $7, $0, $ROPE_CAT_right_end$" "\n"
+               "	addi $3, $3, 1"                 "\n"
+               "	j $ROPE_CAT_right_loop$"        "\n"
+               "$ROPE_CAT_right_end$:"             "\n"
+               "	sub $7, $3, $5"                 "\n"
+               "	beq $7, $0, $ROPE_CAT_end$"     "\n"
+               "$ROPE_CAT_node$:"                  "\n"
+               "	addi $gp, $gp, 3"               "\n"
+               "	srl $gp, $gp, 2"                "\n"
+               "	sll $gp, $gp, 2"                "\n"
+               "	add $6, $6, $7"                 "\n"
+               "	sw $6, 0($gp)"                  "\n"
+               "	sw $4, 4($gp)"                  "\n"
+               "	sw $5, 8($gp)"                  "\n"
+               "	lui $2, 0x8000"                 "\n"
+               "	or $2, $2, $gp"                 "\n"
+               "	addi $gp, $gp, 12"              "\n"
+               "$ROPE_CAT_end$:"                   "\n"
+               "	jr $ra"                         "\n"
+               "\n";
+        codeSize += 37*4;
+        // $2 holds tagged node, returns new flat string in $2
+        out << "$ROPE_FLATTEN$:"                   "\n"
+               "	addi $sp, $sp, -8"              "\n"
+               "	sw $ra, 4($sp)"                 "\n"
+               "	sll $3, $2, 1"                  "\n"
+               "	srl $3, $3, 1"                  "\n"
+               "	lw $6, 0($3)"                   "\n"
+               "	move $5, $gp"                   "\n"
+               "	sw $5, 0($sp)"                  "\n"
+               "	add $gp, $gp, $6"               "\n"
+               "	sb $0, 0($gp)"                  "\n"
+               "	addi $gp, $gp, 1"               "\n"
+               "	move $4, $2"                    "\n"
+               "	jal $ROPE_FILL$"                "\n"
+               "	lw $2, 0($sp)"                  "\n"
+               "	lw $ra, 4($sp)"                 "\n"
+               "	addi $sp, $sp, 8"               "\n"
+               "	jr $ra"                         "\n"
+               "\n";
+        codeSize += 16*4;
+        // copies rope in $4 to $5, flat children are copied directly and the loop continues
+        // with the other child, only nodes with two rope children need recursion
+        out << "$ROPE_FILL$:"                      "\n"
+               "	bgez $4, $ROPE_FILL_flat$"      "\n"
+               "	sll $3, $4, 1"                  "\n"
+               "	srl $3, $3, 1"                  "\n"
+               "	lw $6, 4($3)"                   "\n"
+               "	lw $7, 8($3)"                   "\n"
+               "	bltz $6, $ROPE_FILL_left_rope$" "\n"
+               "$ROPE_FILL_left_copy$:"            "\n"
+               "	lb $3, 0($6)"                   "\n"
+               "	beq $3, $0, $ROPE_FILL_left_end$" "\n"
+               "	sb $3, 0($5)"                   "\n"
+               "	addi $6, $6, 1"                 "\n"
+               "	addi $5, $5, 1"                 "\n"
+               "	j $ROPE_FILL_left_copy$"        "\n"
+               "$ROPE_FILL_left_end$:"             "\n"
+               "	move $4, $7"                    "\n"
+               "	j $ROPE_FILL$"                  "\n"
+               "$ROPE_FILL_left_rope$:"            "\n"
+               "	sll $3, $6, 1"                  "\n"
+               "	srl $3, $3, 1"                  "\n"
+               "	lw $3, 0($3)"                   "\n"
+               "	add $3, $5, $3"                 "\n"
+               "	bltz $7, $ROPE_FILL_right_rope$" "\n"
+               "$ROPE_FILL_right_copy$:"           "\n"
+               "	lb $2, 0($7)"                   "\n"
+               "	beq $2, $0, $ROPE_FILL_right_end$" "\n"
+               "	sb $2, 0($3)"                   "\n"
+               "	addi $7, $7, 1"                 "\n"
+               "	addi $3, $3, 1"                 "\n"
+               "	j $ROPE_FILL_right_copy$"       "\n"
+               "$ROPE_FILL_right_end$:"            "\n"
+               "	move $4, $6"                    "\n"
+               "	j $ROPE_FILL$"                  "\n"
+               "$ROPE_FILL_right_rope$:"           "\n"
+               "	addi $sp, $sp, -12"             "\n"
+               "	sw $ra, 8($sp)"                 "\n"
+               "	sw $6, 4($sp)"                  "\n"
+               "	sw $5, 0($sp)"                  "\n"
+               "	move $4, $7"                    "\n"
+               "	move $5, $3"                    "\n"
+               "	jal $ROPE_FILL$"                "\n"
+               "	lw $5, 0($sp)"                  "\n"
+               "	lw $4, 4($sp)"                  "\n"
+               "	lw $ra, 8($sp)"                 "\n"
+               "	addi $sp, $sp, 12"              "\n"
+               "	j $ROPE_FILL$"                  "\n"
+               "$ROPE_FILL_flat$:"                 "\n"
+               "	lb $3, 0($4)"                   "\n"
+               "	beq $3, $0, $ROPE_FILL_end$"    "\n"
+               "	sb $3, 0($5)"                   "\n"
+               "	addi $4, $4, 1"                 "\n"
+               "	addi $5, $5, 1"                 "\n"
+               "	j $ROPE_FILL_flat$"             "\n"
+               "$ROPE_FILL_end$:"                  "\n"
+               "	jr $ra"                         "\n"
+               "\n";
+        codeSize += 46*4;
+    }
     out << "#Computed Code Size: " << codeSize << "\n";
 
     out << "\n\n\n\n\n\n\n";
     for (auto &it : context){
-         out << it.second.getInstructions().str() << std::endl ;
-         codeSize += it.second.getInstrSize();
+         std::vector<mips::MachineInstruction> code = it.second.getCode();
+         peephole.run(code);
+         scheduler.run(code);
+
+         std::string text;
+         if (delaySlots){
+             // hand written routines above are left to the assembler
+             delaySlotFiller.run(code);
+             text += ".set noreorder\n";
+         }
+         codeSize += mips::printCode(code, text);
+         if (delaySlots)
+             text += ".set reorder\n";
+         out << text << std::endl ;
          out << "#Computed Code Size: " << codeSize << "\n";
          out << "\n\n\n\n\n\n\n";
     }
@@ -87,6 +394,9 @@ std::string ASMgenerator::getTargetCode()
     codeSize += constStringData.getDataSize();
 
     out << "#Computed Code Size: " << codeSize << "\n";
+    out << peephole.getStatistics();
+    if (delaySlots)
+        out << delaySlotFiller.getStatistics();
 
     if (((1024-64)*1024) < codeSize){
         throw(codeSize);
@@ -110,6 +420,20 @@ void ASMgenerator::visit(ir::Function *func)
     // set pointer to newly added reference
 
     activeFunction = &context.at(func);
+    activeFunction->makeLeaf();
+
+    // call area has to be sized before any array gets its offset above it
+    for (ir::BasicBlock* bb : func->getBasicBlocks())
+    {
+        for (ir::Instruction* instr : bb->getInstructions())
+        {
+            if (ir::CallInstruction* call = dynamic_cast<ir::CallInstruction*>(instr))
+            {
+                unsigned args = call->getArguments().size(), regs = mips.getParamRegisters().size();
+                activeFunction->reserveCallArea(args > regs ? args - regs : 0, effects.allocates(call->getFunction()));
+            }
+        }
+    }
 
     for (unsigned int i = 0; i<parameters.size(); i++)
     {
@@ -122,6 +446,7 @@ void ASMgenerator::visit(ir::Function *func)
     {
         activeFunction->addBlock(bb);
     }
+    selector.prepareFunction(func);
 
     // iterate over each basicblock
     for (ir::BasicBlock* bb : func->getBasicBlocks())
@@ -136,7 +461,11 @@ void ASMgenerator::visit(ir::BasicBlock *block)
 {
     activeFunction->addBlock(block);
     activeFunction->setActiveBlock(block);
+    selector.prepareBlock(block);
     for (ir::Instruction* inst : block->getInstructions()){
+            if (usesParamRegisters(inst))
+                activeFunction->Active()->releaseParamRegisters(inst);
+            flattenRopes(inst);
             inst->accept(*this);
             activeFunction->Active()->updateLRU();
     }
@@ -180,7 +509,7 @@ void ASMgenerator::visit(ir::AssignInstruction *instr)
     activeFunction->Active()->markChanged(destReg);
     activeFunction->Active()->markUsed(operand);
 
-    activeFunction->Active()->addInstruction("MOVE", *destReg, *operandReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *destReg, *operandReg);
 
 
 
@@ -189,15 +518,40 @@ void ASMgenerator::visit(ir::AssignInstruction *instr)
 void ASMgenerator::visit(ir::DeclarationInstruction *instr)
 {
     ir::Value *operand = instr->getOperand();
-    activeFunction->addVar(*(static_cast<ir::NamedValue*>(operand)));
-    activeFunction->Active()->getRegister(operand, false);
+    ir::NamedValue *var = static_cast<ir::NamedValue*>(operand);
+    if (!var->isArray()){
+        activeFunction->addVar(*var);
+        activeFunction->Active()->getRegister(operand, false);
+        return;
+    }
+
+    // zero the whole array, small ones are unrolled
+    int offset = activeFunction->getArrayOffset(*var);
+    int bytes = FunctionContext::getArrayBytes(*var);
+    if (bytes <= 8 * 4){
+        for (int i = 0; i < bytes; i += 4)
+            arrayAccess(mips::Opcode::SW, *mips.getZero(), offset + i, mips.getStackPointer());
+        return;
+    }
+
+    const mips::Register *ptrReg = mips.getRetRegister();
+    const mips::Register *endReg = mips.getSecondRetRegister();
+    std::string loopLabel = activeFunction->Active()->createLabel();
+    activeFunction->Active()->addInstruction(mips::Opcode::LI, *ptrReg, offset);
+    activeFunction->Active()->addInstruction(mips::Opcode::ADDU, *ptrReg, *ptrReg, mips.getStackPointer());
+    activeFunction->Active()->addInstruction(mips::Opcode::LI, *endReg, bytes);
+    activeFunction->Active()->addInstruction(mips::Opcode::ADDU, *endReg, *endReg, *ptrReg);
+    activeFunction->Active()->addLabel(loopLabel);
+    activeFunction->Active()->addInstruction(mips::Opcode::SW, *mips.getZero(), 0, *ptrReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::ADDIU, *ptrReg, *ptrReg, 4);
+    activeFunction->Active()->addInstruction(mips::Opcode::BNE, *ptrReg, *endReg, loopLabel);
 }
 
 void ASMgenerator::visit(ir::JumpInstruction *instr)
 {
     activeFunction->Active()->saveUnsavedVariables();
     ir::BasicBlock *jumpBlock = instr->getFollowingBasicBlock();
-    activeFunction->Active()->addInstruction("J", jumpBlock);
+    activeFunction->Active()->addInstruction(mips::Opcode::J, jumpBlock);
 
 
 
@@ -205,17 +559,7 @@ void ASMgenerator::visit(ir::JumpInstruction *instr)
 
 void ASMgenerator::visit(ir::CondJumpInstruction *instr)
 {
-    activeFunction->Active()->saveUnsavedVariables();
-
-    ir::Value *cond =  instr->getCondition();
-    ir::BasicBlock *trueJump = instr->getTrueBasicBlock();
-    ir::BasicBlock *falseJump = instr->getFalseBasicBlock();
-
-    const mips::Register *condReg = activeFunction->Active()->getRegister(cond);
-    activeFunction->Active()->markUsed(cond);
-
-    activeFunction->Active()->addInstruction("BNE", *condReg, *mips.getZero(), trueJump);
-    activeFunction->Active()->addInstruction("B ", falseJump);
+    selector.select(instr, *activeFunction);
 }
 
 void ASMgenerator::visit(ir::ReturnInstruction *instr)
@@ -224,10 +568,10 @@ void ASMgenerator::visit(ir::ReturnInstruction *instr)
     ir::Value *retVal = instr->getOperand();
     if (retVal != nullptr){
         const mips::Register *retReg = activeFunction->Active()->getRegister(retVal);
-        activeFunction->Active()->addInstruction("MOVE", *(mips.getRetRegister()), *retReg );
+        activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getRetRegister()), *retReg );
         activeFunction->Active()->markUsed(retVal);
     }
-    activeFunction->Active()->addInstruction("J", activeFunction->getFunction()->getName() + "_$return\n");
+    activeFunction->Active()->addInstruction(mips::Opcode::J, activeFunction->getFunction()->getName() + "_$return");
 }
 
 void ASMgenerator::visit(ir::CallInstruction *instr)
@@ -236,17 +580,16 @@ void ASMgenerator::visit(ir::CallInstruction *instr)
 
     //activeFunction->Active()->saveUnsavedVariables();//save all registers with namedValue
 
-    bool hasStackTransfer = instr->getArguments().size() > mips.getParamRegisters().size();
-    int requiredSize = 4; // reserve place for GP
-    if (hasStackTransfer) // some parameters are stack transfered -> prepare place
-    {
-        requiredSize += (instr->getArguments().size() - mips.getParamRegisters().size()) *4;
-    }
-    activeFunction->Active()->addInstruction("ADDI", mips.getStackPointer(), mips.getStackPointer(), -(requiredSize));
-
-    int gpOffset = requiredSize - 4;
+    // callee which does not allocate on heap returns with untouched $gp, no need to save it
+    bool saveGP = effects.allocates(instr->getFunction());
+    // returned string may live in callee's heap, decide at runtime whether to adopt or copy it
+    bool adoptResult = saveGP && instr->getResult() && instr->getFunction()->getReturnDataType() == ir::Value::DataType::STRING
+            && !effects.returnsBorrowedString(instr->getFunction());
+    // place for stack transfered parameters and GP is preallocated at the bottom of the frame
+    int gpOffset = activeFunction->getGPSaveOffset();
 
-    activeFunction->Active()->addInstruction("SW", mips.getGlobalPointer(), gpOffset, mips.getStackPointer()); // save GP
+    if (saveGP)
+        activeFunction->Active()->addInstruction(mips::Opcode::SW, mips.getGlobalPointer(), gpOffset, mips.getStackPointer()); // save GP
 
     int stackOffset = 0;
     unsigned int i = 1;
@@ -256,10 +599,10 @@ void ASMgenerator::visit(ir::CallInstruction *instr)
         if (i<=mips.getParamRegisters().size()) {
             const mips::Register *destReg = mips.getParamRegisters()[i-1];
 
-            activeFunction->Active()->addInstruction("MOVE", *destReg, *paramReg);
+            activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *destReg, *paramReg);
         }  else {
             // cdecl convention
-            activeFunction->Active()->addInstruction("SW", *paramReg, stackOffset, mips.getStackPointer());
+            activeFunction->Active()->addInstruction(mips::Opcode::SW, *paramReg, stackOffset, mips.getStackPointer());
             stackOffset += 4;
         }
         activeFunction->Active()->markUsed(param);
@@ -274,11 +617,13 @@ void ASMgenerator::visit(ir::CallInstruction *instr)
     //activeFunction->Active()->clearCallerRegisters();
 
     // function call
-    activeFunction->Active()->addInstruction("JAL", instr->getFunction());
+    activeFunction->Active()->addInstruction(mips::Opcode::JAL, instr->getFunction());
 
     // return stack to valid state
-    activeFunction->Active()->addInstruction("LW", mips.getGlobalPointer(), gpOffset, mips.getStackPointer()); // save GP
-    activeFunction->Active()->addInstruction("ADDI", mips.getStackPointer(), mips.getStackPointer(), requiredSize);
+    if (adoptResult)
+        activeFunction->Active()->addInstruction(mips::Opcode::LW, *(mips.getSecondRetRegister()), gpOffset, mips.getStackPointer()); // $ADOPT_R2$ restores GP
+    else if (saveGP)
+        activeFunction->Active()->addInstruction(mips::Opcode::LW, mips.getGlobalPointer(), gpOffset, mips.getStackPointer()); // restore GP
 
 
 
@@ -290,11 +635,11 @@ void ASMgenerator::visit(ir::CallInstruction *instr)
         activeFunction->Active()->markChanged(destReg);
 
 
-        if (instr->getFunction()->getReturnDataType() == ir::Value::DataType::STRING){
-            // copy string in R2 to local address space and move
-            activeFunction->Active()->addInstruction("JAL", "$MOVE_R2_TO_GP$");
+        if (adoptResult){
+            // adopt or copy string in R2 to local address space and move
+            activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$ADOPT_R2$");
         }
-            activeFunction->Active()->addInstruction("MOVE", *destReg, *(mips.getRetRegister()));
+            activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *destReg, *(mips.getRetRegister()));
 
     }
 
@@ -315,7 +660,7 @@ void ASMgenerator::visit(ir::BuiltinCallInstruction *instr)
         } else {
             destReg = mips.getZero();
         }
-        activeFunction->Active()->addInstruction("READ_CHAR", *destReg);
+        activeFunction->Active()->addInstruction(mips::Opcode::READ_CHAR, *destReg);
     } else if (name == "read_int"){
         if (hasResult){
             destReg = activeFunction->Active()->getRegister(instr->getResult(),false);
@@ -323,17 +668,17 @@ void ASMgenerator::visit(ir::BuiltinCallInstruction *instr)
         } else {
             destReg = mips.getZero();
         }
-        activeFunction->Active()->addInstruction("READ_INT", *destReg);
+        activeFunction->Active()->addInstruction(mips::Opcode::READ_INT, *destReg);
     } else if (name == "read_string"){
         if (hasResult){
             destReg = activeFunction->Active()->getRegister(instr->getResult(),false);
             activeFunction->Active()->markChanged(destReg);
-            activeFunction->Active()->addInstruction("MOVE", *destReg, mips.getGlobalPointer());
-            activeFunction->Active()->addInstruction("READ_STRING", *destReg, *(mips.getParamRegisters()[0]));
-            activeFunction->Active()->addInstruction("ADD", mips.getGlobalPointer(), mips.getGlobalPointer(), *(mips.getParamRegisters()[0]));
-            activeFunction->Active()->addInstruction("ADDIU", mips.getGlobalPointer(), mips.getGlobalPointer(), 1);
+            activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *destReg, mips.getGlobalPointer());
+            activeFunction->Active()->addInstruction(mips::Opcode::READ_STRING, *destReg, *(mips.getParamRegisters()[0]));
+            activeFunction->Active()->addInstruction(mips::Opcode::ADD, mips.getGlobalPointer(), mips.getGlobalPointer(), *(mips.getParamRegisters()[0]));
+            activeFunction->Active()->addInstruction(mips::Opcode::ADDIU, mips.getGlobalPointer(), mips.getGlobalPointer(), 1);
         } else {
-            activeFunction->Active()->addInstruction("READ_STRING", mips.getGlobalPointer(), *(mips.getRetRegister()));
+            activeFunction->Active()->addInstruction(mips::Opcode::READ_STRING, mips.getGlobalPointer(), *(mips.getRetRegister()));
         }
     } else if (name == "get_at"){
         ir::Value *op1 = instr->getArguments()[0];
@@ -353,8 +698,8 @@ void ASMgenerator::visit(ir::BuiltinCallInstruction *instr)
         activeFunction->Active()->markUsed(op1);
         activeFunction->Active()->markUsed(op2);
 
-        activeFunction->Active()->addInstruction("ADD", *destReg, *op1Reg, *op2Reg);
-        activeFunction->Active()->addInstruction("LB", *destReg, 0, *destReg);
+        activeFunction->Active()->addInstruction(mips::Opcode::ADD, *destReg, *op1Reg, *op2Reg);
+        activeFunction->Active()->addInstruction(mips::Opcode::LB, *destReg, 0, *destReg);
 
     } else if (name == "set_at"){
 
@@ -379,13 +724,104 @@ void ASMgenerator::visit(ir::BuiltinCallInstruction *instr)
         activeFunction->Active()->markUsed(op2);
         activeFunction->Active()->markUsed(op3);
 
-        activeFunction->Active()->addInstruction("MOVE", *destReg, mips.getGlobalPointer()); // set ptr to new string
-        activeFunction->Active()->addInstruction("MOVE", *(mips.getRetRegister()), *op1Reg);    // prepare source reg
-        activeFunction->Active()->addInstruction("JAL", "$MOVE_R2_TO_GP$");            // copy
-        activeFunction->Active()->addInstruction("ADD", *(mips.getRetRegister()), *destReg, *op2Reg);
+        std::string copyLabel, endLabel;
+        if (instr->getInPlace() != ir::BuiltinCallInstruction::InPlace::NEVER){
+            // source string is dead after this, store the char directly into it
+            const mips::Register *tmpReg = mips.getSecondRetRegister();
+            if (instr->getInPlace() == ir::BuiltinCallInstruction::InPlace::HEAP_ONLY){
+                // string constants are placed before heap and can't be modified
+                copyLabel = activeFunction->Active()->createLabel();
+                endLabel = activeFunction->Active()->createLabel();
+                activeFunction->Active()->addInstruction(mips::Opcode::LA, *tmpReg, "DATABEGIN");
+                activeFunction->Active()->addInstruction(mips::Opcode::SLTU, *tmpReg, *op1Reg, *tmpReg);
+                activeFunction->Active()->addInstruction(mips::Opcode::BNE, *tmpReg, *mips.getZero(), copyLabel);
+            }
+            activeFunction->Active()->addInstruction(mips::Opcode::ADD, *tmpReg, *op1Reg, *op2Reg);
+            activeFunction->Active()->addInstruction(mips::Opcode::SB, *op3Reg, 0, *tmpReg);
+            activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *destReg, *op1Reg);
+            if (instr->getInPlace() == ir::BuiltinCallInstruction::InPlace::ALWAYS)
+                return;
+
+            activeFunction->Active()->addInstruction(mips::Opcode::B, endLabel);
+            activeFunction->Active()->addLabel(copyLabel);
+        }
+
+        activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *destReg, mips.getGlobalPointer()); // set ptr to new string
+        activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getRetRegister()), *op1Reg);    // prepare source reg
+        activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$MOVE_R2_TO_GP$");            // copy
+        activeFunction->Active()->addInstruction(mips::Opcode::ADD, *(mips.getRetRegister()), *destReg, *op2Reg);
+
+        activeFunction->Active()->addInstruction(mips::Opcode::SB, *op3Reg, 0, *(mips.getRetRegister()));
+        if (!endLabel.empty())
+            activeFunction->Active()->addLabel(endLabel);
+
+    } else if (name == "strlen"){
+        ir::Value *op1 = instr->getArguments()[0];
+        if(!hasResult){
+            activeFunction->Active()->markUsed(op1);
+            return;
+        }
+
+        const mips::Register *op1Reg = activeFunction->Active()->getRegister(op1);
+        destReg = activeFunction->Active()->getRegister(instr->getResult(), false);
+        activeFunction->Active()->markChanged(destReg);
+        activeFunction->Active()->markUsed(op1);
+
+        activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[0]), *op1Reg);
+        activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$STR_LEN$");
+        activeFunction->Active()->addInstruction(mips::Opcode::SUB, *destReg, *(mips.getRetRegister()), *op1Reg);
+    } else if (name == "substr"){
+        ir::Value *op1 = instr->getArguments()[0];
+        ir::Value *op2 = instr->getArguments()[1];
+        ir::Value *op3 = instr->getArguments()[2];
+        if(!hasResult){
+            activeFunction->Active()->markUsed(op1);
+            activeFunction->Active()->markUsed(op2);
+            activeFunction->Active()->markUsed(op3);
+            return;
+        }
+
+        const mips::Register *op1Reg = activeFunction->Active()->getRegister(op1);
+        const mips::Register *op2Reg = activeFunction->Active()->getRegister(op2);
+        const mips::Register *op3Reg = activeFunction->Active()->getRegister(op3);
+        destReg = activeFunction->Active()->getRegister(instr->getResult(), false);
+        activeFunction->Active()->markChanged(destReg);
+        activeFunction->Active()->markUsed(op1);
+        activeFunction->Active()->markUsed(op2);
+        activeFunction->Active()->markUsed(op3);
+
+        activeFunction->Active()->addInstruction(mips::Opcode::ADD, *(mips.getParamRegisters()[0]), *op1Reg, *op2Reg);
+        activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[1]), *op3Reg);
+        activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$SUBSTR$");
+        activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *destReg, *(mips.getRetRegister()));
+    } else if (name == "str_scan" || name == "str_find" || name == "str_mismatch"){
+        ir::Value *op1 = instr->getArguments()[0];
+        ir::Value *op2 = instr->getArguments()[1];
+        ir::Value *op3 = instr->getArguments()[2];
+        // str_scan(s, i, c), str_find(s, i, c) and str_mismatch(a, b, i) return index into the first string
+        ir::Value *index = (name == "str_mismatch") ? op3 : op2;
 
-        activeFunction->Active()->addInstruction("SB", *op3Reg, 0, *(mips.getRetRegister()));
+        const mips::Register *op1Reg = activeFunction->Active()->getRegister(op1);
+        const mips::Register *op2Reg = activeFunction->Active()->getRegister(op2);
+        const mips::Register *op3Reg = activeFunction->Active()->getRegister(op3);
+        const mips::Register *indexReg = activeFunction->Active()->getRegister(index);
+        destReg = activeFunction->Active()->getRegister(instr->getResult(), false);
+        activeFunction->Active()->markChanged(destReg);
+        activeFunction->Active()->markUsed(op1);
+        activeFunction->Active()->markUsed(op2);
+        activeFunction->Active()->markUsed(op3);
 
+        activeFunction->Active()->addInstruction(mips::Opcode::ADD, *(mips.getParamRegisters()[0]), *op1Reg, *indexReg);
+        if (name == "str_mismatch"){
+            activeFunction->Active()->addInstruction(mips::Opcode::ADD, *(mips.getParamRegisters()[1]), *op2Reg, *indexReg);
+            activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$STR_MISMATCH$");
+        } else if (op3Reg == mips.getZero()){
+            activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$STR_LEN$");
+        } else {
+            activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[1]), *op3Reg);
+            activeFunction->Active()->addInstruction(mips::Opcode::JAL, name == "str_scan" ? "$STR_SCAN$" : "$STR_FIND$");
+        }
+        activeFunction->Active()->addInstruction(mips::Opcode::SUB, *destReg, *(mips.getRetRegister()), *op1Reg);
     } else if (name == "strcat"){
         ir::Value *op1 = instr->getArguments()[0];
         ir::Value *op2 = instr->getArguments()[1];
@@ -398,54 +834,123 @@ void ASMgenerator::visit(ir::BuiltinCallInstruction *instr)
 
         const mips::Register *op1Reg = activeFunction->Active()->getRegister(op1);
         const mips::Register *op2Reg = activeFunction->Active()->getRegister(op2);
+        ir::Value *appendEnd = instr->getAppendEnd();
+        const mips::Register *appendEndReg = appendEnd ? activeFunction->Active()->getRegister(appendEnd) : nullptr;
         const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
         activeFunction->Active()->markChanged(destReg);
         activeFunction->Active()->markUsed(op1);
         activeFunction->Active()->markUsed(op2);
 
-        activeFunction->Active()->addInstruction("MOVE", *destReg, mips.getGlobalPointer()); // set ptr to new string
-        activeFunction->Active()->addInstruction("MOVE", *(mips.getRetRegister()), *op1Reg);    // prepare source reg
-        activeFunction->Active()->addInstruction("JAL", "$MOVE_R2_TO_GP$");            // copy
-        activeFunction->Active()->addInstruction("ADDI", mips.getGlobalPointer(), mips.getGlobalPointer(), -1); // concat
-        activeFunction->Active()->addInstruction("MOVE", *(mips.getRetRegister()), *op2Reg);    // prepare source reg
-        activeFunction->Active()->addInstruction("JAL", "$MOVE_R2_TO_GP$");            // copy
+        if (ropeStrings){
+            activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[0]), *op1Reg);
+            activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[1]), *op2Reg);
+            activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$ROPE_CAT$");
+            activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *destReg, *(mips.getRetRegister()));
+            return;
+        }
+
+        std::string copyLabel, endLabel;
+        if (appendEnd){
+            // accumulator still ends at the top of the heap, only overwrite its terminator
+            copyLabel = activeFunction->Active()->createLabel();
+            endLabel = activeFunction->Active()->createLabel();
+            activeFunction->Active()->addInstruction(mips::Opcode::BNE, *appendEndReg, mips.getGlobalPointer(), copyLabel);
+            activeFunction->Active()->addInstruction(mips::Opcode::ADDI, mips.getGlobalPointer(), mips.getGlobalPointer(), -1); // concat
+            activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getRetRegister()), *op2Reg);    // prepare source reg
+            activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$MOVE_R2_TO_GP$");            // copy
+            activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *destReg, *op1Reg);
+            activeFunction->Active()->addInstruction(mips::Opcode::B, endLabel);
+            activeFunction->Active()->addLabel(copyLabel);
+        }
+
+        activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *destReg, mips.getGlobalPointer()); // set ptr to new string
+        activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getRetRegister()), *op1Reg);    // prepare source reg
+        activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$MOVE_R2_TO_GP$");            // copy
+        activeFunction->Active()->addInstruction(mips::Opcode::ADDI, mips.getGlobalPointer(), mips.getGlobalPointer(), -1); // concat
+        activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getRetRegister()), *op2Reg);    // prepare source reg
+        activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$MOVE_R2_TO_GP$");            // copy
+
+        if (appendEnd){
+            activeFunction->Active()->addLabel(endLabel);
+            activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *appendEndReg, mips.getGlobalPointer());
+            activeFunction->Active()->markChanged(appendEndReg);
+        }
     }
 }
 
-void ASMgenerator::visit(ir::AddInstruction *instr)
+void ASMgenerator::visit(ir::LoadIndexedInstruction *instr)
 {
-    ir::Value *left = instr->getLeftOperand();
-    ir::Value *right = instr->getRightOperand();
+    ir::NamedValue *array = static_cast<ir::NamedValue*>(instr->getArray());
+    ir::Value *index = instr->getIndex();
     ir::Value *dest = instr->getResult();
 
-    const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
-    const mips::Register *rightReg = activeFunction->Active()->getRegister(right);
+    int offset = activeFunction->getArrayOffset(*array);
+    int elementSize = FunctionContext::getArrayElementSize(*array);
+    mips::Opcode load = (elementSize == 4) ? mips::Opcode::LW : mips::Opcode::LB;
 
+    if (index->getType() == ir::Value::Type::CONSTANT){
+        const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
+        activeFunction->Active()->markChanged(destReg);
+        offset += static_cast<ir::ConstantValue<int>*>(index)->getConstantValue() * elementSize;
+        arrayAccess(load, *destReg, offset, mips.getStackPointer());
+        return;
+    }
 
+    const mips::Register *indexReg = activeFunction->Active()->getRegister(index);
     const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
     activeFunction->Active()->markChanged(destReg);
-    activeFunction->Active()->markUsed(left);
-    activeFunction->Active()->markUsed(right);
+    activeFunction->Active()->markUsed(index);
 
-    activeFunction->Active()->addInstruction("ADD", *destReg, *leftReg, *rightReg );
+    if (elementSize == 4){
+        activeFunction->Active()->addInstruction(mips::Opcode::SLL, *destReg, *indexReg, 2);
+        activeFunction->Active()->addInstruction(mips::Opcode::ADDU, *destReg, *destReg, mips.getStackPointer());
+    } else {
+        activeFunction->Active()->addInstruction(mips::Opcode::ADDU, *destReg, *indexReg, mips.getStackPointer());
+    }
+    arrayAccess(load, *destReg, offset, *destReg);
 }
 
-void ASMgenerator::visit(ir::SubtractInstruction *instr)
+void ASMgenerator::visit(ir::StoreIndexedInstruction *instr)
 {
-    ir::Value *left = instr->getLeftOperand();
-    ir::Value *right = instr->getRightOperand();
-    ir::Value *dest = instr->getResult();
+    ir::NamedValue *array = static_cast<ir::NamedValue*>(instr->getArray());
+    ir::Value *index = instr->getIndex();
+    ir::Value *value = instr->getValue();
+
+    int offset = activeFunction->getArrayOffset(*array);
+    int elementSize = FunctionContext::getArrayElementSize(*array);
+    mips::Opcode store = (elementSize == 4) ? mips::Opcode::SW : mips::Opcode::SB;
+
+    if (index->getType() == ir::Value::Type::CONSTANT){
+        const mips::Register *valueReg = activeFunction->Active()->getRegister(value);
+        activeFunction->Active()->markUsed(value);
+        offset += static_cast<ir::ConstantValue<int>*>(index)->getConstantValue() * elementSize;
+        arrayAccess(store, *valueReg, offset, mips.getStackPointer());
+        return;
+    }
 
-    const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
-    const mips::Register *rightReg = activeFunction->Active()->getRegister(right);
+    const mips::Register *indexReg = activeFunction->Active()->getRegister(index);
+    const mips::Register *valueReg = activeFunction->Active()->getRegister(value);
+    activeFunction->Active()->markUsed(index);
+    activeFunction->Active()->markUsed(value);
 
+    const mips::Register *addrReg = mips.getRetRegister();
+    if (elementSize == 4){
+        activeFunction->Active()->addInstruction(mips::Opcode::SLL, *addrReg, *indexReg, 2);
+        activeFunction->Active()->addInstruction(mips::Opcode::ADDU, *addrReg, *addrReg, mips.getStackPointer());
+    } else {
+        activeFunction->Active()->addInstruction(mips::Opcode::ADDU, *addrReg, *indexReg, mips.getStackPointer());
+    }
+    arrayAccess(store, *valueReg, offset, *addrReg);
+}
 
-    const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
-    activeFunction->Active()->markChanged(destReg);
-    activeFunction->Active()->markUsed(left);
-    activeFunction->Active()->markUsed(right);
+void ASMgenerator::visit(ir::AddInstruction *instr)
+{
+    selector.select(instr, *activeFunction);
+}
 
-    activeFunction->Active()->addInstruction("SUB", *destReg, *leftReg, *rightReg );
+void ASMgenerator::visit(ir::SubtractInstruction *instr)
+{
+    selector.select(instr, *activeFunction);
 }
 
 void ASMgenerator::visit(ir::MultiplyInstruction *instr)
@@ -454,6 +959,18 @@ void ASMgenerator::visit(ir::MultiplyInstruction *instr)
     ir::Value *right = instr->getRightOperand();
     ir::Value *dest = instr->getResult();
 
+    if (isIntConstant(left))
+        std::swap(left, right);
+    if (isIntConstant(right)){
+        const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
+        const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
+        if (multiplyByConstant(*destReg, *leftReg, intConstant(right))){
+            activeFunction->Active()->markChanged(destReg);
+            activeFunction->Active()->markUsed(left);
+            return;
+        }
+    }
+
     const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
     const mips::Register *rightReg = activeFunction->Active()->getRegister(right);
     const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
@@ -461,7 +978,7 @@ void ASMgenerator::visit(ir::MultiplyInstruction *instr)
     activeFunction->Active()->markUsed(left);
     activeFunction->Active()->markUsed(right);
 
-    activeFunction->Active()->addInstruction("MUL", *destReg, *leftReg, *rightReg  );
+    activeFunction->Active()->addInstruction(mips::Opcode::MUL, *destReg, *leftReg, *rightReg  );
 }
 
 void ASMgenerator::visit(ir::DivideInstruction *instr)
@@ -470,6 +987,16 @@ void ASMgenerator::visit(ir::DivideInstruction *instr)
     ir::Value *right = instr->getRightOperand();
     ir::Value *dest = instr->getResult();
 
+    if (isIntConstant(right)){
+        const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
+        const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
+        if (divideByConstant(*destReg, *leftReg, intConstant(right))){
+            activeFunction->Active()->markChanged(destReg);
+            activeFunction->Active()->markUsed(left);
+            return;
+        }
+    }
+
     const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
     const mips::Register *rightReg = activeFunction->Active()->getRegister(right);
     const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
@@ -477,7 +1004,7 @@ void ASMgenerator::visit(ir::DivideInstruction *instr)
     activeFunction->Active()->markUsed(left);
     activeFunction->Active()->markUsed(right);
 
-    activeFunction->Active()->addInstruction("DIV", *destReg, *leftReg, *rightReg  );
+    activeFunction->Active()->addInstruction(mips::Opcode::DIV, *destReg, *leftReg, *rightReg  );
 }
 
 void ASMgenerator::visit(ir::ModuloInstruction *instr)
@@ -486,6 +1013,16 @@ void ASMgenerator::visit(ir::ModuloInstruction *instr)
     ir::Value *right = instr->getRightOperand();
     ir::Value *dest = instr->getResult();
 
+    if (isIntConstant(right)){
+        const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
+        const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
+        if (moduloByConstant(*destReg, *leftReg, intConstant(right))){
+            activeFunction->Active()->markChanged(destReg);
+            activeFunction->Active()->markUsed(left);
+            return;
+        }
+    }
+
     const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
     const mips::Register *rightReg = activeFunction->Active()->getRegister(right);
     const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
@@ -493,8 +1030,8 @@ void ASMgenerator::visit(ir::ModuloInstruction *instr)
     activeFunction->Active()->markUsed(left);
     activeFunction->Active()->markUsed(right);
 
-    activeFunction->Active()->addInstruction("DIV", *leftReg, *rightReg  );
-    activeFunction->Active()->addInstruction("MFHI", *destReg );
+    activeFunction->Active()->addInstruction(mips::Opcode::DIV, *leftReg, *rightReg  );
+    activeFunction->Active()->addInstruction(mips::Opcode::MFHI, *destReg );
 }
 
 void ASMgenerator::visit(ir::LessInstruction *instr)
@@ -503,6 +1040,9 @@ void ASMgenerator::visit(ir::LessInstruction *instr)
     ir::Value *right = instr->getRightOperand();
     ir::Value *dest = instr->getResult();
 
+    if (selector.select(instr, *activeFunction))
+        return;
+
     const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
     const mips::Register *rightReg = activeFunction->Active()->getRegister(right);
     const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
@@ -510,15 +1050,11 @@ void ASMgenerator::visit(ir::LessInstruction *instr)
     activeFunction->Active()->markUsed(left);
     activeFunction->Active()->markUsed(right);
 
-    if (left->getDataType() == ir::Value::DataType::STRING){
-        //$STR_CMP$
-        activeFunction->Active()->addInstruction("MOVE", *(mips.getParamRegisters()[0]),*leftReg);
-        activeFunction->Active()->addInstruction("MOVE", *(mips.getParamRegisters()[1]),*rightReg);
-        activeFunction->Active()->addInstruction("JAL", "$STR_CMP$");
-        activeFunction->Active()->addInstruction("SLT", *destReg, *mips.getRetRegister(),*mips.getZero());
-    } else {
-        activeFunction->Active()->addInstruction("SLT", *destReg,*leftReg, *rightReg);
-    }
+    //$STR_CMP$
+    activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[0]),*leftReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[1]),*rightReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$STR_CMP$");
+    activeFunction->Active()->addInstruction(mips::Opcode::SLT, *destReg, *mips.getRetRegister(),*mips.getZero());
 }
 
 void ASMgenerator::visit(ir::LessEqualInstruction *instr)
@@ -527,6 +1063,9 @@ void ASMgenerator::visit(ir::LessEqualInstruction *instr)
     ir::Value *right = instr->getRightOperand();
     ir::Value *dest = instr->getResult();
 
+    if (selector.select(instr, *activeFunction))
+        return;
+
     const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
     const mips::Register *rightReg = activeFunction->Active()->getRegister(right);
     const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
@@ -536,21 +1075,13 @@ void ASMgenerator::visit(ir::LessEqualInstruction *instr)
     activeFunction->Active()->markUsed(right);
 
 
-    if (left->getDataType() == ir::Value::DataType::STRING){
-        //$STR_CMP$
-        activeFunction->Active()->addInstruction("MOVE", *(mips.getParamRegisters()[0]),*leftReg);
-        activeFunction->Active()->addInstruction("MOVE", *(mips.getParamRegisters()[1]),*rightReg);
-        activeFunction->Active()->addInstruction("JAL", "$STR_CMP$");
-        activeFunction->Active()->addInstruction("SLT", *destReg, *mips.getRetRegister(), *mips.getZero());
-        activeFunction->Active()->addInstruction("SLTIU", *tempReg, *mips.getRetRegister(), 1);
-        activeFunction->Active()->addInstruction("OR",    *destReg, *destReg, *tempReg);
-    } else {
-        activeFunction->Active()->addInstruction("SLT",   *destReg, *leftReg, *rightReg );
-        activeFunction->Active()->addInstruction("XOR",   *tempReg, *leftReg, *rightReg );
-        activeFunction->Active()->addInstruction("SLTIU", *tempReg, *tempReg, 1);
-        activeFunction->Active()->addInstruction("OR",    *destReg, *destReg, *tempReg);
-    }
-
+    //$STR_CMP$
+    activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[0]),*leftReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[1]),*rightReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$STR_CMP$");
+    activeFunction->Active()->addInstruction(mips::Opcode::SLT, *destReg, *mips.getRetRegister(), *mips.getZero());
+    activeFunction->Active()->addInstruction(mips::Opcode::SLTIU, *tempReg, *mips.getRetRegister(), 1);
+    activeFunction->Active()->addInstruction(mips::Opcode::OR,    *destReg, *destReg, *tempReg);
 }
 
 void ASMgenerator::visit(ir::GreaterInstruction *instr)
@@ -559,6 +1090,9 @@ void ASMgenerator::visit(ir::GreaterInstruction *instr)
     ir::Value *right = instr->getRightOperand();
     ir::Value *dest = instr->getResult();
 
+    if (selector.select(instr, *activeFunction))
+        return;
+
     const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
     const mips::Register *rightReg = activeFunction->Active()->getRegister(right);
     const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
@@ -566,15 +1100,11 @@ void ASMgenerator::visit(ir::GreaterInstruction *instr)
     activeFunction->Active()->markUsed(left);
     activeFunction->Active()->markUsed(right);
 
-    if (left->getDataType() == ir::Value::DataType::STRING){
-        //$STR_CMP$
-        activeFunction->Active()->addInstruction("MOVE", *(mips.getParamRegisters()[0]),*rightReg);
-        activeFunction->Active()->addInstruction("MOVE", *(mips.getParamRegisters()[1]),*leftReg);
-        activeFunction->Active()->addInstruction("JAL", "$STR_CMP$");
-        activeFunction->Active()->addInstruction("SLT", *destReg, *mips.getRetRegister(),*mips.getZero());
-    } else{
-        activeFunction->Active()->addInstruction("SLT", *destReg,*rightReg, *leftReg);
-    }
+    //$STR_CMP$
+    activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[0]),*rightReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[1]),*leftReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$STR_CMP$");
+    activeFunction->Active()->addInstruction(mips::Opcode::SLT, *destReg, *mips.getRetRegister(),*mips.getZero());
 }
 
 void ASMgenerator::visit(ir::GreaterEqualInstruction *instr)
@@ -583,6 +1113,9 @@ void ASMgenerator::visit(ir::GreaterEqualInstruction *instr)
     ir::Value *right = instr->getRightOperand();
     ir::Value *dest = instr->getResult();
 
+    if (selector.select(instr, *activeFunction))
+        return;
+
     const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
     const mips::Register *rightReg = activeFunction->Active()->getRegister(right);
     const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
@@ -592,21 +1125,13 @@ void ASMgenerator::visit(ir::GreaterEqualInstruction *instr)
     activeFunction->Active()->markUsed(right);
 
 
-    if (left->getDataType() == ir::Value::DataType::STRING){
-        //$STR_CMP$
-        activeFunction->Active()->addInstruction("MOVE", *(mips.getParamRegisters()[1]),*leftReg);
-        activeFunction->Active()->addInstruction("MOVE", *(mips.getParamRegisters()[0]),*rightReg);
-        activeFunction->Active()->addInstruction("JAL", "$STR_CMP$");
-        activeFunction->Active()->addInstruction("SLT", *destReg, *mips.getRetRegister(), *mips.getZero());
-        activeFunction->Active()->addInstruction("SLTIU", *tempReg, *mips.getRetRegister(), 1);
-        activeFunction->Active()->addInstruction("OR",    *destReg, *destReg, *tempReg);
-    } else {
-        activeFunction->Active()->addInstruction("SLT",   *destReg, *rightReg, *leftReg );
-        activeFunction->Active()->addInstruction("XOR",   *tempReg, *rightReg, *leftReg );
-        activeFunction->Active()->addInstruction("SLTIU", *tempReg, *tempReg, 1);
-        activeFunction->Active()->addInstruction("OR",    *destReg, *destReg, *tempReg);
-    }
-
+    //$STR_CMP$
+    activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[1]),*leftReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[0]),*rightReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$STR_CMP$");
+    activeFunction->Active()->addInstruction(mips::Opcode::SLT, *destReg, *mips.getRetRegister(), *mips.getZero());
+    activeFunction->Active()->addInstruction(mips::Opcode::SLTIU, *tempReg, *mips.getRetRegister(), 1);
+    activeFunction->Active()->addInstruction(mips::Opcode::OR,    *destReg, *destReg, *tempReg);
 }
 
 void ASMgenerator::visit(ir::EqualInstruction *instr)
@@ -616,6 +1141,11 @@ void ASMgenerator::visit(ir::EqualInstruction *instr)
     ir::Value *right = instr->getRightOperand();
     ir::Value *dest = instr->getResult();
 
+    if (selector.select(instr, *activeFunction))
+        return;
+    if (inlineStringEquality(left, right, dest, true))
+        return;
+
     const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
     const mips::Register *rightReg = activeFunction->Active()->getRegister(right);
     const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
@@ -623,16 +1153,10 @@ void ASMgenerator::visit(ir::EqualInstruction *instr)
     activeFunction->Active()->markUsed(left);
     activeFunction->Active()->markUsed(right);
 
-    if (left->getDataType() == ir::Value::DataType::STRING){
-        activeFunction->Active()->addInstruction("MOVE", *(mips.getParamRegisters()[1]),*leftReg);
-        activeFunction->Active()->addInstruction("MOVE", *(mips.getParamRegisters()[0]),*rightReg);
-        activeFunction->Active()->addInstruction("JAL", "$STR_CMP$");
-         activeFunction->Active()->addInstruction("SLTIU", *destReg, *mips.getRetRegister(), 1);
-    } else {
-        activeFunction->Active()->addInstruction("XOR",*destReg, *leftReg, *rightReg);
-        activeFunction->Active()->addInstruction("SLTIU", *destReg, *destReg, 1);
-    }
-
+    activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[1]),*leftReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[0]),*rightReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$STR_CMP$");
+     activeFunction->Active()->addInstruction(mips::Opcode::SLTIU, *destReg, *mips.getRetRegister(), 1);
 }
 
 void ASMgenerator::visit(ir::NotEqualInstruction *instr)
@@ -641,6 +1165,11 @@ void ASMgenerator::visit(ir::NotEqualInstruction *instr)
     ir::Value *right = instr->getRightOperand();
     ir::Value *dest = instr->getResult();
 
+    if (selector.select(instr, *activeFunction))
+        return;
+    if (inlineStringEquality(left, right, dest, false))
+        return;
+
     const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
     const mips::Register *rightReg = activeFunction->Active()->getRegister(right);
     const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
@@ -648,106 +1177,93 @@ void ASMgenerator::visit(ir::NotEqualInstruction *instr)
     activeFunction->Active()->markUsed(left);
     activeFunction->Active()->markUsed(right);
 
-    if (left->getDataType() == ir::Value::DataType::STRING){
-        activeFunction->Active()->addInstruction("MOVE", *(mips.getParamRegisters()[1]),*leftReg);
-        activeFunction->Active()->addInstruction("MOVE", *(mips.getParamRegisters()[0]),*rightReg);
-        activeFunction->Active()->addInstruction("JAL", "$STR_CMP$");
-        activeFunction->Active()->addInstruction("SLTU", *destReg, *mips.getZero(), *mips.getRetRegister());
-    } else {
-        activeFunction->Active()->addInstruction("XOR",*destReg, *leftReg, *rightReg);
-        activeFunction->Active()->addInstruction("SLTU", *destReg, *mips.getZero(), *destReg);
-    }
+    activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[1]),*leftReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getParamRegisters()[0]),*rightReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$STR_CMP$");
+    activeFunction->Active()->addInstruction(mips::Opcode::SLTU, *destReg, *mips.getZero(), *mips.getRetRegister());
 }
 
 void ASMgenerator::visit(ir::AndInstruction *instr)
 {
-
-    ir::Value *left = instr->getLeftOperand();
-    ir::Value *right = instr->getRightOperand();
-    ir::Value *dest = instr->getResult();
-
-
-    const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
-    const mips::Register *rightReg = activeFunction->Active()->getRegister(right);
-    const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
-    const mips::Register *tempReg = activeFunction->Active()->getFreeRegister();
-    activeFunction->Active()->markChanged(destReg);
-    activeFunction->Active()->markUsed(left);
-    activeFunction->Active()->markUsed(right);
-
-
-    activeFunction->Active()->addInstruction("SLTU",   *tempReg, *mips.getZero(), *leftReg );
-    activeFunction->Active()->addInstruction("SLTU",   *destReg, *mips.getZero(), *rightReg );
-    activeFunction->Active()->addInstruction("AND",    *destReg, *destReg, *tempReg);
-
+    selector.select(instr, *activeFunction);
 }
 
 void ASMgenerator::visit(ir::OrInstruction *instr)
 {
-    ir::Value *left = instr->getLeftOperand();
-    ir::Value *right = instr->getRightOperand();
-    ir::Value *dest = instr->getResult();
+    selector.select(instr, *activeFunction);
+}
 
-    const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
-    const mips::Register *rightReg = activeFunction->Active()->getRegister(right);
-    const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
-    const mips::Register *tempReg = activeFunction->Active()->getFreeRegister();
-    activeFunction->Active()->markChanged(destReg);
-    activeFunction->Active()->markUsed(left);
-    activeFunction->Active()->markUsed(right);
+void ASMgenerator::visit(ir::BitwiseAndInstruction *instr)
+{
+    selector.select(instr, *activeFunction);
+}
 
+void ASMgenerator::visit(ir::BitwiseOrInstruction *instr)
+{
+    selector.select(instr, *activeFunction);
+}
 
-    activeFunction->Active()->addInstruction("SLTU",   *tempReg, *mips.getZero(), *leftReg );
-    activeFunction->Active()->addInstruction("SLTU",   *destReg, *mips.getZero(), *rightReg );
-    activeFunction->Active()->addInstruction("OR",     *destReg, *destReg, *tempReg);
+void ASMgenerator::visit(ir::BitwiseXorInstruction *instr)
+{
+    selector.select(instr, *activeFunction);
 }
 
-void ASMgenerator::visit(ir::BitwiseAndInstruction *instr)
+void ASMgenerator::visit(ir::ShiftLeftInstruction *instr)
 {
     ir::Value *left = instr->getLeftOperand();
     ir::Value *right = instr->getRightOperand();
     ir::Value *dest = instr->getResult();
 
     const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
+    if (right->getType() == ir::Value::Type::CONSTANT){
+        const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
+        activeFunction->Active()->markChanged(destReg);
+        activeFunction->Active()->markUsed(left);
+
+        int amount = static_cast<ir::ConstantValue<int>*>(right)->getConstantValue();
+        activeFunction->Active()->addInstruction(mips::Opcode::SLL, *destReg, *leftReg, amount & 31);
+        return;
+    }
+
     const mips::Register *rightReg = activeFunction->Active()->getRegister(right);
     const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
     activeFunction->Active()->markChanged(destReg);
     activeFunction->Active()->markUsed(left);
     activeFunction->Active()->markUsed(right);
 
-
-    activeFunction->Active()->addInstruction("AND", *destReg, *leftReg, *rightReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::SLLV, *destReg, *leftReg, *rightReg);
 }
 
-void ASMgenerator::visit(ir::BitwiseOrInstruction *instr)
+void ASMgenerator::visit(ir::ShiftRightInstruction *instr)
 {
     ir::Value *left = instr->getLeftOperand();
     ir::Value *right = instr->getRightOperand();
     ir::Value *dest = instr->getResult();
 
+    // int is signed, so the shift is arithmetic
     const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
+    if (right->getType() == ir::Value::Type::CONSTANT){
+        const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
+        activeFunction->Active()->markChanged(destReg);
+        activeFunction->Active()->markUsed(left);
+
+        int amount = static_cast<ir::ConstantValue<int>*>(right)->getConstantValue();
+        activeFunction->Active()->addInstruction(mips::Opcode::SRA, *destReg, *leftReg, amount & 31);
+        return;
+    }
+
     const mips::Register *rightReg = activeFunction->Active()->getRegister(right);
     const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
     activeFunction->Active()->markChanged(destReg);
     activeFunction->Active()->markUsed(left);
     activeFunction->Active()->markUsed(right);
 
-
-    activeFunction->Active()->addInstruction("OR", *destReg, *leftReg, *rightReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::SRAV, *destReg, *leftReg, *rightReg);
 }
 
 void ASMgenerator::visit(ir::NotInstruction *instr)
 {
-    ir::Value *op = instr->getOperand();
-    ir::Value *dest = instr->getResult();
-
-    const mips::Register *opReg = activeFunction->Active()->getRegister(op);
-    const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
-    activeFunction->Active()->markChanged(destReg);
-    activeFunction->Active()->markUsed(op);
-
-    activeFunction->Active()->addInstruction("SLTIU", *destReg, *opReg, 1);
-
+    selector.select(instr, *activeFunction);
 }
 
 void ASMgenerator::visit(ir::TypecastInstruction *instr)
@@ -769,16 +1285,16 @@ void ASMgenerator::visit(ir::TypecastInstruction *instr)
             case ir::Value::DataType::INT:
             {
                 //char to int, simply move
-                activeFunction->Active()->addInstruction("MOVE", *destReg, *opReg);
+                activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *destReg, *opReg);
                 break;
             }
             case ir::Value::DataType::STRING:
             {
                 //char to str -- make new string str("c");
-                activeFunction->Active()->addInstruction("MOVE", *destReg, mips.getGlobalPointer());
-                activeFunction->Active()->addInstruction("SB", *opReg, 0,*destReg);
-                activeFunction->Active()->addInstruction("SB", *mips.getZero(), 1, *destReg);
-                activeFunction->Active()->addInstruction("ADDI", mips.getGlobalPointer(), mips.getGlobalPointer(), 2);
+                activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *destReg, mips.getGlobalPointer());
+                activeFunction->Active()->addInstruction(mips::Opcode::SB, *opReg, 0,*destReg);
+                activeFunction->Active()->addInstruction(mips::Opcode::SB, *mips.getZero(), 1, *destReg);
+                activeFunction->Active()->addInstruction(mips::Opcode::ADDI, mips.getGlobalPointer(), mips.getGlobalPointer(), 2);
                 break;
             }
         default: break;
@@ -792,7 +1308,7 @@ void ASMgenerator::visit(ir::TypecastInstruction *instr)
             case ir::Value::DataType::CHAR:
             {
                 //int to char -> only least significant
-                activeFunction->Active()->addInstruction("ANDI", *destReg, *opReg, 0xFF);
+                activeFunction->Active()->addInstruction(mips::Opcode::ANDI, *destReg, *opReg, 0xFF);
                 break;
             }
             case ir::Value::DataType::STRING:
@@ -837,7 +1353,7 @@ void ASMgenerator::visit(ir::BitwiseNotInstruction *instr)
     activeFunction->Active()->markChanged(destReg);
     activeFunction->Active()->markUsed(op);
 
-    activeFunction->Active()->addInstruction("NOR", *destReg, *opReg, *mips.getZero());
+    activeFunction->Active()->addInstruction(mips::Opcode::NOR, *destReg, *opReg, *mips.getZero());
 }
 
 void ASMgenerator::visit(ir::NegInstruction *instr)
@@ -850,7 +1366,48 @@ void ASMgenerator::visit(ir::NegInstruction *instr)
     activeFunction->Active()->markChanged(destReg);
     activeFunction->Active()->markUsed(op);
 
-    activeFunction->Active()->addInstruction("SUB", *destReg, *mips.getZero(),*opReg);
+    activeFunction->Active()->addInstruction(mips::Opcode::SUB, *destReg, *mips.getZero(),*opReg);
+}
+
+bool ASMgenerator::inlineStringEquality(ir::Value *left, ir::Value *right, ir::Value *dest, bool equal)
+{
+    if (left->getDataType() != ir::Value::DataType::STRING)
+        return false;
+
+    // constant is usually on the right side, but doesn't matter for equality
+    if (left->getType() == ir::Value::Type::CONSTANT)
+        std::swap(left, right);
+    if (right->getType() != ir::Value::Type::CONSTANT)
+        return false;
+
+    ir::ConstantValue<std::string> *constant = static_cast<ir::ConstantValue<std::string>*>(right);
+    std::string text = ir::unescapeStringConstant(constant->getConstantValue());
+    if (text.length() > InlineStrCmpMaxLength)
+        return false;
+
+    const mips::Register *leftReg = activeFunction->Active()->getRegister(left);
+    const mips::Register *destReg = activeFunction->Active()->getRegister(dest, false);
+    activeFunction->Active()->markChanged(destReg);
+    activeFunction->Active()->markUsed(left);
+    activeFunction->Active()->markUsed(right);
+
+    // destReg stays zero while characters match, first difference jumps out,
+    // shorter string is caught by its terminator, longer one by the final check
+    std::string endLabel = activeFunction->Active()->createLabel();
+    activeFunction->Active()->addCanonicalInstruction("#inlined string comparison");
+    for (unsigned int i = 0; i < text.length(); i++){
+        activeFunction->Active()->addInstruction(mips::Opcode::LBU, *destReg, i, *leftReg);
+        activeFunction->Active()->addInstruction(mips::Opcode::XORI, *destReg, *destReg, static_cast<unsigned char>(text[i]));
+        activeFunction->Active()->addInstruction(mips::Opcode::BNE, *destReg, *mips.getZero(), endLabel);
+    }
+    activeFunction->Active()->addInstruction(mips::Opcode::LBU, *destReg, text.length(), *leftReg);
+    activeFunction->Active()->addLabel(endLabel);
+
+    if (equal)
+        activeFunction->Active()->addInstruction(mips::Opcode::SLTIU, *destReg, *destReg, 1);
+    else
+        activeFunction->Active()->addInstruction(mips::Opcode::SLTU, *destReg, *mips.getZero(), *destReg);
+    return true;
 }
 
 ConstStringData &ASMgenerator::getStringTable()
@@ -858,6 +1415,171 @@ ConstStringData &ASMgenerator::getStringTable()
     return constStringData;
 }
 
+void ASMgenerator::flattenRopes(ir::Instruction *instr)
+{
+    if (!ropeStrings)
+        return;
+
+    // only strcat can work with ropes, assignment just copies the pointer
+    ir::BuiltinCallInstruction *builtinInst = dynamic_cast<ir::BuiltinCallInstruction*>(instr);
+    if (dynamic_cast<ir::AssignInstruction*>(instr) || (builtinInst && builtinInst->getFunctionName() == "strcat"))
+        return;
+
+    for (ir::Value *operand : ir::getInstructionOperands(instr)){
+        if (operand->getType() == ir::Value::Type::CONSTANT || operand->getDataType() != ir::Value::DataType::STRING)
+            continue;
+
+        // flat string replaces the rope in the same register, so it is flattened only once
+        const mips::Register *reg = activeFunction->Active()->getRegister(operand);
+        std::string flatLabel = activeFunction->Active()->createLabel();
+        activeFunction->Active()->addInstruction(mips::Opcode::BGEZ, *reg, flatLabel);
+        activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *(mips.getRetRegister()), *reg);
+        activeFunction->Active()->addInstruction(mips::Opcode::JAL, "$ROPE_FLATTEN$");
+        activeFunction->Active()->addInstruction(mips::Opcode::MOVE, *reg, *(mips.getRetRegister()));
+        activeFunction->Active()->addLabel(flatLabel);
+        activeFunction->Active()->markChanged(reg);
+    }
+}
+
+bool ASMgenerator::multiplyByConstant(const mips::Register &dest, const mips::Register &src, int value)
+{
+    // only constants with at most two bits set or a run of ones are cheaper than MUL
+    BlockContext *block = activeFunction->Active();
+    const mips::Register &scratch = *mips.getRetRegister();
+    uint32_t abs = value < 0 ? -static_cast<uint32_t>(value) : value;
+    int single = log2Exact(abs);
+    int high = -1, low = -1, run = log2Exact(abs + 1);
+    if (single < 0 && run < 0){
+        low = log2Exact(abs & -abs);
+        high = log2Exact(abs & ~(abs & -abs));
+        if (high < 0)
+            return false;
+    }
+
+    if (abs == 0){
+        block->addInstruction(mips::Opcode::MOVE, dest, *mips.getZero());
+        return true;
+    } else if (single == 0){
+        block->addInstruction(mips::Opcode::MOVE, dest, src);
+    } else if (single > 0){
+        block->addInstruction(mips::Opcode::SLL, dest, src, single);
+    } else if (run > 0){
+        block->addInstruction(mips::Opcode::SLL, scratch, src, run);
+        block->addInstruction(mips::Opcode::SUBU, dest, scratch, src);
+    } else {
+        block->addInstruction(mips::Opcode::SLL, scratch, src, high);
+        if (low == 0){
+            block->addInstruction(mips::Opcode::ADDU, dest, scratch, src);
+        } else {
+            block->addInstruction(mips::Opcode::SLL, dest, src, low);
+            block->addInstruction(mips::Opcode::ADDU, dest, dest, scratch);
+        }
+    }
+
+    if (value < 0)
+        block->addInstruction(mips::Opcode::SUBU, dest, *mips.getZero(), dest);
+    return true;
+}
+
+bool ASMgenerator::divideByConstant(const mips::Register &dest, const mips::Register &src, int value)
+{
+    BlockContext *block = activeFunction->Active();
+    const mips::Register &scratch = *mips.getRetRegister();
+    const mips::Register &scratch2 = *mips.getSecondRetRegister();
+    if (value == 0)
+        return false;
+
+    uint32_t abs = value < 0 ? -static_cast<uint32_t>(value) : value;
+    int log = log2Exact(abs);
+    if (log == 0){
+        block->addInstruction(mips::Opcode::MOVE, dest, src);
+    } else if (log > 0){
+        // negative dividends need to be biased by divisor - 1 to round towards zero
+        if (log == 1){
+            block->addInstruction(mips::Opcode::SRL, scratch, src, 31);
+        } else {
+            block->addInstruction(mips::Opcode::SRA, scratch, src, 31);
+            block->addInstruction(mips::Opcode::SRL, scratch, scratch, 32 - log);
+        }
+        block->addInstruction(mips::Opcode::ADDU, scratch, scratch, src);
+        block->addInstruction(mips::Opcode::SRA, dest, scratch, log);
+    } else {
+        int32_t magic;
+        int shift;
+        signedDivisionMagic(value, magic, shift);
+        block->addInstruction(mips::Opcode::LI, scratch, magic);
+        block->addInstruction(mips::Opcode::MULT, src, scratch);
+        block->addInstruction(mips::Opcode::MFHI, scratch);
+        if (value > 0 && magic < 0)
+            block->addInstruction(mips::Opcode::ADDU, scratch, scratch, src);
+        else if (value < 0 && magic > 0)
+            block->addInstruction(mips::Opcode::SUBU, scratch, scratch, src);
+        if (shift > 0)
+            block->addInstruction(mips::Opcode::SRA, scratch, scratch, shift);
+        // add one to negative quotients to round towards zero
+        block->addInstruction(mips::Opcode::SRL, scratch2, scratch, 31);
+        block->addInstruction(mips::Opcode::ADDU, dest, scratch, scratch2);
+        return true;
+    }
+
+    if (value < 0)
+        block->addInstruction(mips::Opcode::SUBU, dest, *mips.getZero(), dest);
+    return true;
+}
+
+bool ASMgenerator::moduloByConstant(const mips::Register &dest, const mips::Register &src, int value)
+{
+    BlockContext *block = activeFunction->Active();
+    const mips::Register &scratch = *mips.getRetRegister();
+    const mips::Register &scratch2 = *mips.getSecondRetRegister();
+    if (value == 0)
+        return false;
+
+    // remainder has the sign of the dividend, so the sign of the divisor does not matter
+    uint32_t abs = value < 0 ? -static_cast<uint32_t>(value) : value;
+    int log = log2Exact(abs);
+    if (log == 0){
+        block->addInstruction(mips::Opcode::MOVE, dest, *mips.getZero());
+        return true;
+    } else if (log > 0 && log <= 16){
+        if (log == 1){
+            block->addInstruction(mips::Opcode::SRL, scratch, src, 31);
+        } else {
+            block->addInstruction(mips::Opcode::SRA, scratch, src, 31);
+            block->addInstruction(mips::Opcode::SRL, scratch, scratch, 32 - log);
+        }
+        block->addInstruction(mips::Opcode::ADDU, scratch2, src, scratch);
+        block->addInstruction(mips::Opcode::ANDI, scratch2, scratch2, static_cast<int>(abs - 1));
+        block->addInstruction(mips::Opcode::SUBU, dest, scratch2, scratch);
+        return true;
+    }
+
+    // src - (src / value) * value is only worth it when the multiplication is cheap
+    uint32_t low = abs & -abs;
+    uint32_t rest = abs & ~low;
+    if (log < 0 && log2Exact(rest) < 0 && log2Exact(abs + 1) < 0)
+        return false;
+
+    divideByConstant(scratch2, src, value);
+    multiplyByConstant(scratch2, scratch2, value);
+    block->addInstruction(mips::Opcode::SUBU, dest, src, scratch2);
+    return true;
+}
+
+void ASMgenerator::arrayAccess(mips::Opcode inst, const mips::Register &reg, int offset, const mips::Register &base)
+{
+    if (offset >= -32768 && offset <= 32767){
+        activeFunction->Active()->addInstruction(inst, reg, offset, base);
+        return;
+    }
+
+    // offset does not fit into the instruction, $3 is free outside of runtime routines
+    const mips::Register *tmpReg = mips.getSecondRetRegister();
+    activeFunction->Active()->addInstruction(mips::Opcode::LI, *tmpReg, offset);
+    activeFunction->Active()->addInstruction(mips::Opcode::ADDU, *tmpReg, *tmpReg, base);
+    activeFunction->Active()->addInstruction(inst, reg, 0, *tmpReg);
+}
+
 void ASMgenerator::builtin_print(std::vector<ir::Value *> &params)
 {
     for(auto &item : params){
@@ -866,13 +1588,13 @@ void ASMgenerator::builtin_print(std::vector<ir::Value *> &params)
 
         switch (item->getDataType()) {
         case ir::Value::DataType::INT:
-            activeFunction->Active()->addInstruction("print_int", *opReg);
+            activeFunction->Active()->addInstruction(mips::Opcode::PRINT_INT, *opReg);
             break;
         case ir::Value::DataType::CHAR:
-            activeFunction->Active()->addInstruction("print_char", *opReg);
+            activeFunction->Active()->addInstruction(mips::Opcode::PRINT_CHAR, *opReg);
             break;
         case ir::Value::DataType::STRING:
-            activeFunction->Active()->addInstruction("print_string", *opReg);
+            activeFunction->Active()->addInstruction(mips::Opcode::PRINT_STRING, *opReg);
             break;
         default:
             break;
@@ -8,9 +8,14 @@
 #include "ir/ir_visitor.h"
 #include "ir/builder.h"
 #include "ir/function.h"
+#include "ir/effect_analysis.h"
 #include "mips.h"
 #include <list>
 #include "functioncontext.h"
+#include "backend/instructionselector.h"
+#include "backend/peephole.h"
+#include "backend/scheduler.h"
+#include "backend/delayslotfiller.h"
 #include "backend/conststringdata.h"
 
 namespace backend {
@@ -19,7 +24,9 @@ namespace backend {
 class ASMgenerator : public ir::IrVisitor
 {
 public:
-    ASMgenerator();
+    // ropeStrings makes strcat create concatenation nodes instead of copying,
+    // delaySlots fills branch delay slots and emits the functions in noreorder mode
+    ASMgenerator(bool ropeStrings = false, bool delaySlots = false);
     virtual ~ASMgenerator();
     int translateIR(ir::Builder &builder);
     std::string getTargetCode();
@@ -39,6 +46,8 @@ public:
     virtual void visit(ir::ReturnInstruction* instr) override;
     virtual void visit(ir::CallInstruction* instr) override;
     virtual void visit(ir::BuiltinCallInstruction* instr) override;
+    virtual void visit(ir::LoadIndexedInstruction* instr) override;
+    virtual void visit(ir::StoreIndexedInstruction* instr) override;
     virtual void visit(ir::AddInstruction* instr) override;
     virtual void visit(ir::SubtractInstruction* instr) override;
     virtual void visit(ir::MultiplyInstruction* instr) override;
@@ -54,6 +63,9 @@ public:
     virtual void visit(ir::OrInstruction* instr) override;
     virtual void visit(ir::BitwiseAndInstruction* instr) override;
     virtual void visit(ir::BitwiseOrInstruction* instr) override;
+    virtual void visit(ir::BitwiseXorInstruction* instr) override;
+    virtual void visit(ir::ShiftLeftInstruction* instr) override;
+    virtual void visit(ir::ShiftRightInstruction* instr) override;
     virtual void visit(ir::NotInstruction* instr) override;
     virtual void visit(ir::TypecastInstruction* instr) override;
     virtual void visit(ir::BitwiseNotInstruction* instr) override;
@@ -70,8 +82,30 @@ private:
 
 
     ConstStringData constStringData;
+    ir::EffectAnalysis effects;
+    // int arithmetic, comparisons and conditional jumps are selected by tree patterns
+    InstructionSelector selector;
+    // redundancies left by the register allocation are removed from the final code
+    Peephole peephole;
+    // independent instructions are moved into the latency of loads, mult and div
+    Scheduler scheduler;
+    DelaySlotFiller delaySlotFiller;
+    bool ropeStrings;
+    bool delaySlots;
 
     void builtin_print(std::vector<ir::Value*> &params);
+    void arrayAccess(mips::Opcode inst, const mips::Register &reg, int offset, const mips::Register &base);
+
+    // strength reduction of operations with constant right operand, dest may be the same
+    // register as src, $2 and $3 are used as scratch; false means nothing was emitted
+    bool multiplyByConstant(const mips::Register &dest, const mips::Register &src, int value);
+    bool divideByConstant(const mips::Register &dest, const mips::Register &src, int value);
+    bool moduloByConstant(const mips::Register &dest, const mips::Register &src, int value);
+    void flattenRopes(ir::Instruction *instr);
+
+    // comparisons against constants up to this length are inlined instead of calling $STR_CMP$
+    static const unsigned int InlineStrCmpMaxLength = 8;
+    bool inlineStringEquality(ir::Value *left, ir::Value *right, ir::Value *dest, bool equal);
 };
 
 
@@ -4,6 +4,7 @@
  **/
 
 #include <algorithm>
+#include <set>
 #include <string>
 
 #include "blockcontext.h"
@@ -17,13 +18,14 @@ namespace backend{
 BlockContext::BlockContext(backend::FunctionContext *Parent, const ir::BasicBlock *Block):
     parent(Parent), block(Block)
 {
-    registerTable.resize(getMips()->getEvalRegisters().size());
-    auto tableItem = registerTable.begin();
-
     for(auto &regIter: getMips()->getEvalRegisters()){
-        tableItem->reg = regIter;
-        tableItem->val = nullptr;
-        tableItem++;
+        // variables of leaf function own their registers
+        if (parent->isHomeRegister(regIter))
+            continue;
+        registerItem item = registerItem();
+        item.reg = regIter;
+        item.val = nullptr;
+        registerTable.push_back(item);
     }
 }
 
@@ -38,18 +40,6 @@ const std::string BlockContext::getName() const
     return parent->getFunction()->getName() + "_$" + std::to_string(block->getId());
 }
 
-const std::string BlockContext::getInstructions() const
-{
-    std::string instr;
-
-    instr += getName() + ":    #BLOCK START LABEL\n";
-    //instr += Indent + "addi $sp, $sp, " + std::to_string(-(int)spillTable.size() * 4) + "\n";
-    instr += text.str();
-    //instr += Indent + "addi $sp, $sp, " + std::to_string(spillTable.size() * 4) + "\n";
-
-    return instr;
-}
-
 const mips::MIPS *BlockContext::getMips() const
 {
     return parent->getMips();
@@ -60,119 +50,166 @@ const ir::BasicBlock *BlockContext::getBlock() const
     return block;
 }
 
+std::vector<mips::MachineInstruction> &BlockContext::getCode()
+{
+    return code;
+}
+
+const std::vector<mips::MachineInstruction> &BlockContext::getCode() const
+{
+    return code;
+}
+
 void BlockContext::addCanonicalInstruction(const std::string &inst)
 {
-    text << backend::Indent << inst << "\n";
+    code.push_back(mips::MachineInstruction::comment(inst));
 }
 
 void BlockContext::addLabel(const std::string &label)
 {
-    text << label << ":\n";
+    code.push_back(mips::MachineInstruction::label(label));
+}
+
+const std::string BlockContext::createLabel()
+{
+    // local label inside of the block, e.g. for inlined loops
+    return getName() + "_" + std::to_string(labelCounter++);
 }
 
-void BlockContext::addInstruction(const std::string &inst, const mips::Register &reg)
+void BlockContext::addInstruction(const mips::MachineInstruction &inst)
 {
-    updateInstrSize(inst);
-    text << backend::Indent;
-    text << inst << " " << reg.getAsmName() << "\n";;
+    code.push_back(inst);
 }
 
-void BlockContext::addInstruction(const std::string &inst, const std::string &op)
+void BlockContext::addInstruction(mips::Opcode inst, const mips::Register &reg)
 {
-    updateInstrSize(inst);
-    text << backend::Indent;
-    text << inst << " " << op << "\n";;
+    code.emplace_back(inst, std::vector<mips::Operand>{mips::Operand::reg(reg)});
 }
 
-void BlockContext::addInstruction(const std::string &inst, const mips::Register &dst, const mips::Register &src)
+void BlockContext::addInstruction(mips::Opcode inst, const std::string &op)
 {
-    updateInstrSize(inst);
-    text << backend::Indent;
-    text << inst << " " << dst.getAsmName() << ", " << src.getAsmName() << "\n";
+    code.emplace_back(inst, std::vector<mips::Operand>{mips::Operand::label(op)});
 }
 
-void BlockContext::addInstruction(const std::string &inst, const mips::Register &dst, const int imm)
+void BlockContext::addInstruction(mips::Opcode inst, const mips::Register &dst, const mips::Register &src)
 {
-    updateInstrSize(inst);
-    text << backend::Indent;
-    text << inst << " " << dst.getAsmName() << ", " << imm << "\n";
+    code.emplace_back(inst, std::vector<mips::Operand>{mips::Operand::reg(dst), mips::Operand::reg(src)});
 }
 
-void BlockContext::addInstruction(const std::string &inst, const mips::Register &reg, const std::string &label)
+void BlockContext::addInstruction(mips::Opcode inst, const mips::Register &dst, const int imm)
 {
-    updateInstrSize(inst);
-    text << backend::Indent;
-    text << inst << " " << reg.getAsmName() << ", " << label << "\n";
+    code.emplace_back(inst, std::vector<mips::Operand>{mips::Operand::reg(dst), mips::Operand::imm(imm)});
 }
 
-void BlockContext::addInstruction(const std::string &inst, const ir::BasicBlock *block)
+void BlockContext::addInstruction(mips::Opcode inst, const mips::Register &reg, const std::string &label)
+{
+    code.emplace_back(inst, std::vector<mips::Operand>{mips::Operand::reg(reg), mips::Operand::label(label)});
+}
+
+void BlockContext::addInstruction(mips::Opcode inst, const ir::BasicBlock *block)
 {
-    updateInstrSize(inst);
     const BlockContext* context = parent->getBlockContext(block);
 
-    text << backend::Indent;
-    text << inst << " " << context->getName() << "\n";
+    code.emplace_back(inst, std::vector<mips::Operand>{mips::Operand::label(context->getName())});
 }
 
-void BlockContext::addInstruction(const std::string &inst, const ir::Function *func)
+void BlockContext::addInstruction(mips::Opcode inst, const ir::Function *func)
 {
-    updateInstrSize(inst);
-    text << backend::Indent;
-    text << inst << " " << func->getName() << "\n";
+    code.emplace_back(inst, std::vector<mips::Operand>{mips::Operand::label(func->getName())});
 }
 
-void BlockContext::addInstruction(const std::string &inst, const mips::Register &dst,const int imm, const mips::Register &src)
+void BlockContext::addInstruction(mips::Opcode inst, const mips::Register &dst,const int imm, const mips::Register &src)
 {
-    updateInstrSize(inst);
-    text << backend::Indent;
-    text << inst << " " << dst.getAsmName() << ", " << imm << "(" << src.getAsmName() << ")" << "\n";
+    code.emplace_back(inst, std::vector<mips::Operand>{mips::Operand::reg(dst), mips::Operand::mem(imm, src)});
 }
 
-void BlockContext::addInstruction(const std::string &inst, const mips::Register &dst, const mips::Register &op1, const int imm)
+void BlockContext::addInstruction(mips::Opcode inst, const mips::Register &dst, const mips::Register &op1, const int imm)
 {
-    updateInstrSize(inst);
-    text << backend::Indent;
-    text << inst << " " << dst.getAsmName() << ", "  << op1.getAsmName() << ", " << imm << "\n";
+    code.emplace_back(inst, std::vector<mips::Operand>{mips::Operand::reg(dst), mips::Operand::reg(op1), mips::Operand::imm(imm)});
 }
 
-void BlockContext::addInstruction(const std::string &inst, const mips::Register &op1, const mips::Register &op2, const ir::BasicBlock *block)
+void BlockContext::addInstruction(mips::Opcode inst, const mips::Register &op1, const mips::Register &op2, const ir::BasicBlock *block)
 {
-    updateInstrSize(inst);
     const BlockContext* context = parent->getBlockContext(block);
 
-    text << backend::Indent;
-    text << inst << " " << op1.getAsmName() << ", "  << op2.getAsmName() << ", " << context->getName() << "\n";
+    code.emplace_back(inst, std::vector<mips::Operand>{mips::Operand::reg(op1), mips::Operand::reg(op2), mips::Operand::label(context->getName())});
 }
 
-void BlockContext::addInstruction(const std::string &inst, const mips::Register &dst, const mips::Register &op1, const mips::Register &op2)
+void BlockContext::addInstruction(mips::Opcode inst, const mips::Register &op1, const mips::Register &op2, const std::string &label)
 {
-    updateInstrSize(inst);
-    text << backend::Indent;
-    text << inst << " " << dst.getAsmName() << ", "  << op1.getAsmName() << ", "  << op2.getAsmName() << "\n";
+    code.emplace_back(inst, std::vector<mips::Operand>{mips::Operand::reg(op1), mips::Operand::reg(op2), mips::Operand::label(label)});
 }
 
-void BlockContext::addInstruction(const std::string &inst, const mips::Register &dst, const mips::Register &op1, const int imm, const mips::Register &op2)
+void BlockContext::addInstruction(mips::Opcode inst, const mips::Register &dst, const mips::Register &op1, const mips::Register &op2)
 {
-    updateInstrSize(inst);
-    text << backend::Indent;
-    text << inst << " " << dst.getAsmName() << ", "  << op1.getAsmName() << ", " << imm << "(" << op2.getAsmName() << ")" << "\n";
+    code.emplace_back(inst, std::vector<mips::Operand>{mips::Operand::reg(dst), mips::Operand::reg(op1), mips::Operand::reg(op2)});
+}
+
+void BlockContext::addInstruction(mips::Opcode inst, const mips::Register &dst, const mips::Register &op1, const int imm, const mips::Register &op2)
+{
+    code.emplace_back(inst, std::vector<mips::Operand>{mips::Operand::reg(dst), mips::Operand::reg(op1), mips::Operand::mem(imm, op2)});
 }
 
 
 void BlockContext::saveUnsavedVariables()
 {
+    // parameters stay in their registers until the end of the block, only the ones used
+    // by following blocks are needed on stack
+    const std::set<ir::Value*> &liveOut = parent->getLiveness().getLiveOut(const_cast<ir::BasicBlock*>(block));
+    for (auto &it : paramTable){
+        if (it.val != nullptr && !it.saved && liveOut.count(it.val)){
+            int offset = parent->getVarOffset(*static_cast<ir::NamedValue*>(it.val));
+            addInstruction(mips::Opcode::SW, *(it.reg), -offset, getMips()->getFramePointer());
+            it.saved = true;
+        }
+    }
     for( auto &it: registerTable){
         if(it.val == nullptr) continue;
         if(it.val->getType() == ir::Value::Type::NAMED && it.saved == false)
         {
             ir::NamedValue *value = static_cast<ir::NamedValue*>(it.val);
             int offset = parent->getVarOffset(*value);
-            addInstruction("sw", *(it.reg),-offset, getMips()->getFramePointer());
+            addInstruction(mips::Opcode::SW, *(it.reg),-offset, getMips()->getFramePointer());
             it.saved = true;
         }
     }
 }
 
+void BlockContext::addParamRegister(ir::Value *param, const mips::Register *reg)
+{
+    registerItem item = registerItem();
+    item.reg = reg;
+    item.val = param;
+    item.saved = false; // not on stack until it has to be
+    paramTable.push_back(item);
+}
+
+void BlockContext::releaseParamRegisters(ir::Instruction *instr)
+{
+    std::vector<ir::Value*> operands = ir::getInstructionOperands(instr);
+    for (auto &it : paramTable){
+        if (it.val == nullptr)
+            continue;
+        ir::Value *param = it.val;
+        it.val = nullptr;
+
+        bool live = parent->getLiveness().isLiveAfter(instr, param);
+        if (live && !it.saved){
+            int offset = parent->getVarOffset(*static_cast<ir::NamedValue*>(param));
+            addInstruction(mips::Opcode::SW, *(it.reg), -offset, getMips()->getFramePointer());
+        }
+        if (std::find(operands.begin(), operands.end(), param) != operands.end()){
+            // stack copy of a dead parameter is never read again
+            registerItem *item = getFreeTableItem();
+            item->lruValue = 0;
+            item->saved = true;
+            item->val = param;
+            parent->testCalleeSaved(item->reg);
+            addInstruction(mips::Opcode::MOVE, *(item->reg), *(it.reg));
+        }
+    }
+}
+
 void BlockContext::saveTemporaries()
 {
     for( auto &it: registerTable){
@@ -183,7 +220,7 @@ void BlockContext::saveTemporaries()
 
             ir::TemporaryValue* tmp = static_cast<ir::TemporaryValue*>(it.val);
             addCanonicalInstruction("# temporaryValue " + tmp->getSymbolicName() + " got spill offset ... " + std::to_string(-(int)pos) + "($fp)");
-            addInstruction("sw", *(it.reg), -pos, getMips()->getFramePointer());
+            addInstruction(mips::Opcode::SW, *(it.reg), -pos, getMips()->getFramePointer());
 
             it.val = nullptr;             // remove from mapping
         }
@@ -203,12 +240,12 @@ void BlockContext::saveVarsAndClear()
 
                 ir::TemporaryValue* tmp = static_cast<ir::TemporaryValue*>(it.val);
                 addCanonicalInstruction("# temporaryValue " + tmp->getSymbolicName() + " got spill offset ... " + std::to_string(-(int)pos) + "($fp)");
-                addInstruction("sw", *(it.reg), -pos, getMips()->getFramePointer());
+                addInstruction(mips::Opcode::SW, *(it.reg), -pos, getMips()->getFramePointer());
             } else if(it.val->getType() == ir::Value::Type::NAMED && it.saved == false)
             {
                 ir::NamedValue *value = static_cast<ir::NamedValue*>(it.val);
                 int offset = parent->getVarOffset(*value);
-                addInstruction("sw", *(it.reg),-offset, getMips()->getFramePointer());
+                addInstruction(mips::Opcode::SW, *(it.reg),-offset, getMips()->getFramePointer());
                 it.saved = true;
             }
             it.val = nullptr;             // remove from mapping
@@ -244,6 +281,13 @@ const mips::Register *BlockContext::getRegister(ir::Value *val, bool load)
         }
     }
 
+    if (const mips::Register *home = parent->getHome(val))
+        return home;
+    for (auto &it : paramTable){
+        if (it.val == val)
+            return it.reg;
+    }
+
     // try to find item in registers
     for( auto &it: registerTable){
         if (it.val == nullptr) continue;
@@ -301,15 +345,15 @@ const mips::Register *BlockContext::getRegister(ir::Value *val, bool load)
     if (val->getType() == ir::Value::Type::CONSTANT){
         if (val->getDataType() == ir::Value::DataType::INT){
             ir::ConstantValue<int> *tmp = static_cast<ir::ConstantValue<int>*>(val);
-            addInstruction("li", *(item->reg), tmp->getConstantValue());
+            addInstruction(mips::Opcode::LI, *(item->reg), tmp->getConstantValue());
 
         } else if (val->getDataType() == ir::Value::DataType::CHAR){
             ir::ConstantValue<char> *tmp = static_cast<ir::ConstantValue<char>*>(val);
-            addInstruction("li", *(item->reg), tmp->getConstantValue());
+            addInstruction(mips::Opcode::LI, *(item->reg), tmp->getConstantValue());
 
         } else if (val->getDataType() == ir::Value::DataType::STRING){
             //ir::ConstantValue<std::string> *tmp = static_cast<ir::ConstantValue<std::string>*>(val);
-            addInstruction("la", *(item->reg), getStringTable().getLabel(val));
+            addInstruction(mips::Opcode::LA, *(item->reg), getStringTable().getLabel(val));
         }
 
 
@@ -322,7 +366,7 @@ const mips::Register *BlockContext::getRegister(ir::Value *val, bool load)
         int offset = parent->getVarOffset(*namVal);
         if (load){
             // load to register if required
-            addInstruction("lw", *(item->reg), -offset, getMips()->getFramePointer());
+            addInstruction(mips::Opcode::LW, *(item->reg), -offset, getMips()->getFramePointer());
         }
 
     } else if (val->getType() == ir::Value::Type::TEMPORARY){
@@ -333,7 +377,7 @@ const mips::Register *BlockContext::getRegister(ir::Value *val, bool load)
             int offset = parent->unspillTemp(val);
             if (offset != -1){
                 // spilled item, load it back to register
-                    addInstruction("lw", *(item->reg),-offset, getMips()->getFramePointer());
+                    addInstruction(mips::Opcode::LW, *(item->reg),-offset, getMips()->getFramePointer());
             }
         }
     }
@@ -350,6 +394,12 @@ const mips::Register *BlockContext::getFreeRegister()
 
 void BlockContext::markChanged(const mips::Register *reg)
 {
+    for (auto &it : paramTable){
+        if (it.reg == reg && it.val != nullptr){
+            it.saved = false;
+            return;
+        }
+    }
     for( auto &it: registerTable){
         if (it.reg == reg){
             it.saved = false;
@@ -421,7 +471,7 @@ void BlockContext::removeVictim()
         addCanonicalInstruction("#Spilled variable is " + named->getName());
         if (!registerTable[posMaxLRU].saved){
             int offset = parent->getVarOffset(*named);
-            addInstruction("sw", *(registerTable[posMaxLRU].reg),-offset, getMips()->getFramePointer());
+            addInstruction(mips::Opcode::SW, *(registerTable[posMaxLRU].reg),-offset, getMips()->getFramePointer());
         }
 
     } else if (val->getType() == ir::Value::Type::TEMPORARY){
@@ -431,7 +481,7 @@ void BlockContext::removeVictim()
         unsigned int offset = parent->spillTemp(val);
 
         addCanonicalInstruction("# temporaryValue " + tmp->getSymbolicName() + " got spill offset ... " + std::to_string(-(int)offset) + "($fp)");
-        addInstruction("sw", *(registerTable[posMaxLRU].reg), -offset, getMips()->getFramePointer());
+        addInstruction(mips::Opcode::SW, *(registerTable[posMaxLRU].reg), -offset, getMips()->getFramePointer());
     }
 
 
@@ -444,41 +494,6 @@ ConstStringData &backend::BlockContext::getStringTable()
     return parent->getStringTable();
 }
 
-void BlockContext::updateInstrSize(const std::string &str)
-{
-
-    std::string lower;
-    transform(str.begin(), str.end(), lower.begin(),::tolower);
-
-    if (lower == "la"){
-        parent->addInstrSize(8);
-    } else if (lower == "li"){
-        parent->addInstrSize(8);
-    } else if (lower == "bgt"){
-        parent->addInstrSize(8);
-    } else if (lower == "blt"){
-        parent->addInstrSize(8);
-    } else if (lower == "bge"){
-        parent->addInstrSize(8);
-    } else if (lower == "ble"){
-        parent->addInstrSize(8);
-    } else if (lower == "blez"){
-        parent->addInstrSize(8);
-    } else if (lower == "bgtu"){
-        parent->addInstrSize(8);
-    } else if (lower == "bgtz"){
-        parent->addInstrSize(8);
-    } else if (lower == "mul"){
-        parent->addInstrSize(8);
-    } else if (lower == "div"){
-        parent->addInstrSize(8);
-    } else if (lower == "rem"){
-        parent->addInstrSize(8);
-    } else{
-         parent->addInstrSize(4);
-    }
-}
-
 
 
 } // namespace end
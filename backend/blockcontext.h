@@ -14,6 +14,7 @@
 #include "ir/instruction.h"
 #include "ir/basic_block.h"
 #include "backend/mips.h"
+#include "backend/machineinstruction.h"
 #include "backend/conststringdata.h"
 
 
@@ -49,27 +50,37 @@ public:
     ~BlockContext();
 
     const std::string getName() const;
-    const std::string getInstructions() const ;
     const mips::MIPS *getMips() const ;
 
     const ir::BasicBlock *getBlock() const;
 
+    std::vector<mips::MachineInstruction> &getCode();
+    const std::vector<mips::MachineInstruction> &getCode() const;
+
     void addCanonicalInstruction(const std::string &inst);
     void addLabel(const std::string &label);
-    void addInstruction(const std::string &inst, const mips::Register &reg);
-    void addInstruction(const std::string &inst, const std::string &op);
-    void addInstruction(const std::string &inst, const mips::Register &dst, const mips::Register &src);
-    void addInstruction(const std::string &inst, const mips::Register &dst, const int imm);
-    void addInstruction(const std::string &inst, const mips::Register &reg, const std::string &label);
-    void addInstruction(const std::string &inst, const ir::BasicBlock *block);
-    void addInstruction(const std::string &inst, const ir::Function *func);
-    void addInstruction(const std::string &inst, const mips::Register &dst , const int imm, const mips::Register &src);
-    void addInstruction(const std::string &inst, const mips::Register &dst , const mips::Register &op1, const int imm);
-    void addInstruction(const std::string &inst, const mips::Register &op1 , const mips::Register &op2, const ir::BasicBlock *block);
-    void addInstruction(const std::string &inst, const mips::Register &dst , const mips::Register &op1, const mips::Register &op2);
-    void addInstruction(const std::string &inst, const mips::Register &dst , const mips::Register &op1, const int imm, const mips::Register &op2);
+    const std::string createLabel();
+    void addInstruction(const mips::MachineInstruction &inst);
+    void addInstruction(mips::Opcode inst, const mips::Register &reg);
+    void addInstruction(mips::Opcode inst, const std::string &op);
+    void addInstruction(mips::Opcode inst, const mips::Register &dst, const mips::Register &src);
+    void addInstruction(mips::Opcode inst, const mips::Register &dst, const int imm);
+    void addInstruction(mips::Opcode inst, const mips::Register &reg, const std::string &label);
+    void addInstruction(mips::Opcode inst, const ir::BasicBlock *block);
+    void addInstruction(mips::Opcode inst, const ir::Function *func);
+    void addInstruction(mips::Opcode inst, const mips::Register &dst , const int imm, const mips::Register &src);
+    void addInstruction(mips::Opcode inst, const mips::Register &dst , const mips::Register &op1, const int imm);
+    void addInstruction(mips::Opcode inst, const mips::Register &op1 , const mips::Register &op2, const ir::BasicBlock *block);
+    void addInstruction(mips::Opcode inst, const mips::Register &op1 , const mips::Register &op2, const std::string &label);
+    void addInstruction(mips::Opcode inst, const mips::Register &dst , const mips::Register &op1, const mips::Register &op2);
+    void addInstruction(mips::Opcode inst, const mips::Register &dst , const mips::Register &op1, const int imm, const mips::Register &op2);
 
     void saveUnsavedVariables();
+    // parameter arriving in the register is kept there until the register is needed
+    void addParamRegister(ir::Value *param, const mips::Register *reg);
+    // frees argument registers before instr overwrites them, parameters live after it are
+    // stored, the ones it reads are copied to other registers
+    void releaseParamRegisters(ir::Instruction *instr);
     void saveTemporaries();
     void saveVarsAndClear();
     void clearCallerRegisters();
@@ -95,16 +106,15 @@ private:
     const ir::BasicBlock *block;
 
     std::vector<registerItem> registerTable;
+    std::vector<registerItem> paramTable;   // parameters in argument registers, never allocated to other values
 
-    std::stringstream text;
+    std::vector<mips::MachineInstruction> code;
+    unsigned int labelCounter = 0;
 
     registerItem *getFreeTableItem();
     void removeVictim();
 
     ConstStringData &getStringTable();
-
-    void updateInstrSize(const std::string &str);
-
 };
 
 } // namespace end
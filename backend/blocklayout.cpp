@@ -0,0 +1,199 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+#include "blocklayout.h"
+
+
+namespace backend{
+
+namespace {
+
+const int MaxLoopDepth = 6;
+const double ForcedWeight = 1e30;
+
+double getFrequency(int depth)
+{
+    return std::pow(10.0, std::min(depth, MaxLoopDepth));
+}
+
+} // anonymous namespace
+
+BlockLayout::BlockLayout(const ir::Function *func, const std::vector<const ir::BasicBlock*> &blocks):
+    blocks(blocks)
+{
+    for (size_t i = 0; i < blocks.size(); i++)
+        index[blocks[i]] = i;
+
+    findSuccessors();
+    findLoops();
+    layout(func);
+}
+
+void BlockLayout::findSuccessors()
+{
+    successors.resize(blocks.size());
+    fallsThrough.resize(blocks.size(), false);
+
+    for (size_t i = 0; i < blocks.size(); i++){
+        ir::Instruction *term = blocks[i]->getTerminalInstruction();
+        std::vector<ir::BasicBlock*> targets;
+
+        if (ir::JumpInstruction *jump = dynamic_cast<ir::JumpInstruction*>(term)){
+            targets.push_back(jump->getFollowingBasicBlock());
+        } else if (ir::CondJumpInstruction *jump = dynamic_cast<ir::CondJumpInstruction*>(term)){
+            targets.push_back(jump->getTrueBasicBlock());
+            targets.push_back(jump->getFalseBasicBlock());
+        } else if (dynamic_cast<ir::ReturnInstruction*>(term) == nullptr && i + 1 < blocks.size()){
+            // no jump at the end, code continues with the next block which has to stay there
+            fallsThrough[i] = true;
+            successors[i].push_back(i + 1);
+        }
+
+        for (ir::BasicBlock *target : targets){
+            auto itr = index.find(target);
+            if (itr != index.end() && std::find(successors[i].begin(), successors[i].end(), itr->second) == successors[i].end())
+                successors[i].push_back(itr->second);
+        }
+    }
+}
+
+void BlockLayout::findLoops()
+{
+    std::vector<std::vector<int>> predecessors(blocks.size());
+    for (size_t i = 0; i < blocks.size(); i++){
+        for (int succ : successors[i])
+            predecessors[succ].push_back(i);
+    }
+
+    // depth-first search, edge to a block on the stack closes a loop
+    enum { WHITE, GRAY, BLACK };
+    std::vector<int> color(blocks.size(), WHITE);
+    std::map<int, std::set<int>> loops; // header -> body
+    std::vector<std::pair<int, size_t>> stack;
+
+    if (!blocks.empty()){
+        stack.push_back(std::make_pair(0, 0));
+        color[0] = GRAY;
+    }
+    while (!stack.empty()){
+        int block = stack.back().first;
+        size_t &next = stack.back().second;
+        if (next == successors[block].size()){
+            color[block] = BLACK;
+            stack.pop_back();
+            continue;
+        }
+
+        int succ = successors[block][next++];
+        if (color[succ] == WHITE){
+            color[succ] = GRAY;
+            stack.push_back(std::make_pair(succ, 0));
+        } else if (color[succ] == GRAY){
+            // back edge, body consists of blocks reaching its source without passing the header
+            std::set<int> &body = loops[succ];
+            std::vector<int> work{block};
+            body.insert(succ);
+            while (!work.empty()){
+                int member = work.back();
+                work.pop_back();
+                if (!body.insert(member).second)
+                    continue;
+                for (int pred : predecessors[member])
+                    work.push_back(pred);
+            }
+        }
+    }
+
+    depth.assign(blocks.size(), 0);
+    for (auto &loop : loops){
+        for (int member : loop.second)
+            depth[member]++;
+    }
+}
+
+std::vector<BlockLayout::Edge> BlockLayout::getEdges() const
+{
+    std::vector<Edge> edges;
+    for (size_t i = 0; i < blocks.size(); i++){
+        if (fallsThrough[i]){
+            edges.push_back(Edge{static_cast<int>(i), successors[i][0], ForcedWeight});
+            continue;
+        }
+
+        // branch is expected to stay in the loop rather than to leave it
+        double sum = 0;
+        for (int succ : successors[i])
+            sum += getFrequency(depth[succ]);
+        for (int succ : successors[i])
+            edges.push_back(Edge{static_cast<int>(i), succ, getFrequency(depth[i]) * getFrequency(depth[succ]) / sum});
+    }
+
+    std::stable_sort(edges.begin(), edges.end(), [](const Edge &a, const Edge &b){ return a.weight > b.weight; });
+    return edges;
+}
+
+void BlockLayout::layout(const ir::Function *func)
+{
+    if (blocks.empty())
+        return;
+
+    std::vector<std::vector<int>> chains(blocks.size());
+    std::vector<int> chainOf(blocks.size());
+    for (size_t i = 0; i < blocks.size(); i++){
+        chains[i].push_back(i);
+        chainOf[i] = i;
+    }
+
+    std::vector<Edge> edges = getEdges();
+    for (const Edge &edge : edges){
+        int from = chainOf[edge.from], to = chainOf[edge.to];
+        // entry block has to stay at the start of the function
+        if (from == to || edge.to == 0 || chains[from].back() != edge.from || chains[to].front() != edge.to)
+            continue;
+
+        for (int block : chains[to]){
+            chains[from].push_back(block);
+            chainOf[block] = from;
+        }
+        chains[to].clear();
+    }
+
+    // chain of the default return is placed last as it falls through to the epilogue
+    auto terminal = index.find(func->getTerminalBasicBlock());
+    int lastChain = terminal != index.end() ? chainOf[terminal->second] : -1;
+
+    std::vector<bool> placed(blocks.size(), false);
+    int chain = chainOf[0];
+    while (chain != -1){
+        for (int block : chains[chain]){
+            order.push_back(blocks[block]);
+            placed[block] = true;
+        }
+        chains[chain].clear();
+
+        // next is the chain entered by the heaviest edge from the placed code
+        chain = -1;
+        double best = -1;
+        for (const Edge &edge : edges){
+            int candidate = chainOf[edge.to];
+            if (placed[edge.from] && !chains[candidate].empty() && candidate != lastChain && edge.weight > best){
+                best = edge.weight;
+                chain = candidate;
+            }
+        }
+        for (size_t i = 0; chain == -1 && i < blocks.size(); i++){
+            if (!chains[chainOf[i]].empty() && chainOf[i] != lastChain)
+                chain = chainOf[i];
+        }
+        if (chain == -1 && lastChain != -1 && !chains[lastChain].empty())
+            chain = lastChain;
+    }
+}
+
+} // namespace backend
@@ -0,0 +1,57 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#ifndef BLOCKLAYOUT_H
+#define BLOCKLAYOUT_H
+
+#include <map>
+#include <vector>
+
+#include "ir/instruction.h"
+#include "ir/basic_block.h"
+#include "ir/function.h"
+
+
+namespace backend{
+
+/**
+ * Orders basic blocks of a function so that the likely successor of a block follows it
+ * and the jump to it can be dropped by the peephole pass.
+ *
+ * There is no profile, so the frequency of a block is estimated from its loop depth,
+ * loops are found from back edges of a depth-first search. Edges are taken from the
+ * heaviest and blocks are chained along them (Pettis-Hansen), the chains are then
+ * placed after the chain entered by the heaviest edge.
+ */
+class BlockLayout
+{
+public:
+    BlockLayout(const ir::Function *func, const std::vector<const ir::BasicBlock*> &blocks);
+
+    const std::vector<const ir::BasicBlock*> &getOrder() const {return order;}
+
+private:
+    struct Edge{
+        int from;
+        int to;
+        double weight;
+    };
+
+    std::vector<const ir::BasicBlock*> blocks;  // original order, entry block is the first one
+    std::map<const ir::BasicBlock*, int> index;
+    std::vector<std::vector<int>> successors;
+    std::vector<bool> fallsThrough;             // block without jump at its end
+    std::vector<int> depth;                     // number of loops the block is part of
+    std::vector<const ir::BasicBlock*> order;
+
+    void findSuccessors();
+    void findLoops();
+    std::vector<Edge> getEdges() const;
+    void layout(const ir::Function *func);
+};
+
+} // namespace backend
+
+#endif // BLOCKLAYOUT_H
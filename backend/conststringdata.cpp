@@ -17,21 +17,19 @@ const std::string &ConstStringData::getLabel(ir::Value *val)
         // found
         return table.at(val);
     }
-    // find by value
-    for( auto &it : table){
-        ir::ConstantValue<std::string> *tmp = static_cast<ir::ConstantValue<std::string>*>(it.first);
-        ir::ConstantValue<std::string> *cVal = static_cast<ir::ConstantValue<std::string>*>(val);
-        if (tmp->getConstantValue() == cVal->getConstantValue()){
-            return it.second;
-        }
+    // find by value, constants created by optimizations are often duplicates
+    ir::ConstantValue<std::string> *cVal = static_cast<ir::ConstantValue<std::string>*>(val);
+    auto interned = labels.find(cVal->getConstantValue());
+    if (interned != labels.end()){
+        return interned->second;
     }
 
 
     std::string label = "String_" + std::to_string(table.size()) ;
-    ir::ConstantValue<std::string> *cVal = static_cast<ir::ConstantValue<std::string>*>(val);
     datasize += cVal->getConstantValue().size()+1;
 
     table.emplace(val, label);
+    labels.emplace(cVal->getConstantValue(), label);
     return table.at(val);
 }
 
@@ -20,6 +20,7 @@ public:
 
 private:
     std::map<ir::Value*, std::string> table;
+    std::map<std::string, std::string> labels; // interned strings, by value
     int datasize;
 };
 
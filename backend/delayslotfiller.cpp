@@ -0,0 +1,256 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#include "delayslotfiller.h"
+
+
+namespace backend{
+
+namespace {
+
+const char *sourceNames[] = { "preceding instruction", "target", "fallthrough", "nop" };
+
+const unsigned ReturnAddress = 31;
+
+} // anonymous namespace
+
+DelaySlotFiller::DelaySlotFiller():
+    filled(), code(nullptr)
+{
+
+}
+
+void DelaySlotFiller::run(std::vector<mips::MachineInstruction> &code)
+{
+    this->code = &code;
+    slot.assign(code.size(), false);
+    analyze();
+
+    for (size_t i = 0; i < code.size(); i++){
+        if (!hasDelaySlot(code[i]) || (i + 1 < code.size() && slot[i + 1]))
+            continue;
+        if (fillFromBefore(i))
+            continue;
+
+        if (code[i].isConditionalBranch()){
+            analyze();
+            // backward branch is likely taken, it closes a loop
+            auto itr = labels.find(code[i].getTarget());
+            if (itr != labels.end() && itr->second < i){
+                if (fillFromTarget(i) || fillFromFallthrough(i))
+                    continue;
+            } else if (fillFromFallthrough(i) || fillFromTarget(i))
+                continue;
+        } else if (!code[i].isCall() && code[i].getOpcode() != mips::Opcode::JR){
+            analyze();
+            if (fillFromTarget(i))
+                continue;
+        }
+
+        insert(i + 1, mips::MachineInstruction(mips::Opcode::NOP), true);
+        filled[NOP]++;
+    }
+    this->code = nullptr;
+}
+
+const std::string DelaySlotFiller::getStatistics() const
+{
+    std::string text;
+    for (int source = 0; source < SOURCE_COUNT; source++)
+        text += "#Delay slots filled from " + std::string(sourceNames[source]) + ": " + std::to_string(filled[source]) + "\n";
+    return text;
+}
+
+bool DelaySlotFiller::hasDelaySlot(const mips::MachineInstruction &inst)
+{
+    return inst.isCall() || inst.isConditionalBranch() || inst.getOpcode() == mips::Opcode::B
+            || inst.getOpcode() == mips::Opcode::J || inst.getOpcode() == mips::Opcode::JR;
+}
+
+bool DelaySlotFiller::fitsSlot(const mips::MachineInstruction &inst)
+{
+    // pseudo instruction expanded into more words would leave the slot
+    return !inst.isLabel() && !inst.isComment() && !hasDelaySlot(inst) && !inst.isUnconditionalJump()
+            && inst.getOpcode() != mips::Opcode::NOP && !inst.hasSideEffect() && inst.getSize() == 4;
+}
+
+bool DelaySlotFiller::isSpeculable(const mips::MachineInstruction &inst)
+{
+    switch (inst.getOpcode()){
+    case mips::Opcode::ADDU: case mips::Opcode::ADDIU: case mips::Opcode::SUBU:
+    case mips::Opcode::AND: case mips::Opcode::ANDI: case mips::Opcode::OR: case mips::Opcode::ORI:
+    case mips::Opcode::XOR: case mips::Opcode::XORI: case mips::Opcode::NOR:
+    case mips::Opcode::SLL: case mips::Opcode::SLLV: case mips::Opcode::SRL: case mips::Opcode::SRA: case mips::Opcode::SRAV:
+    case mips::Opcode::SLT: case mips::Opcode::SLTI: case mips::Opcode::SLTU: case mips::Opcode::SLTIU:
+    case mips::Opcode::LI: case mips::Opcode::LUI: case mips::Opcode::MOVE:
+    case mips::Opcode::MFHI: case mips::Opcode::MFLO: case mips::Opcode::MUL:
+        return true;
+    default:
+        // add, sub and addi trap on overflow, loads on bad address
+        return false;
+    }
+}
+
+void DelaySlotFiller::insert(size_t pos, const mips::MachineInstruction &inst, bool isSlot)
+{
+    code->insert(code->begin() + pos, inst);
+    slot.insert(slot.begin() + pos, isSlot);
+}
+
+void DelaySlotFiller::erase(size_t pos)
+{
+    code->erase(code->begin() + pos);
+    slot.erase(slot.begin() + pos);
+}
+
+void DelaySlotFiller::analyze()
+{
+    labels.clear();
+    targets.clear();
+    for (size_t i = 0; i < code->size(); i++){
+        if ((*code)[i].isLabel())
+            labels[(*code)[i].getText()] = i;
+        if (!(*code)[i].getTarget().empty())
+            targets.insert((*code)[i].getTarget());
+    }
+
+    // backward liveness, everything is live at the end of the function and before calls
+    live.assign(code->size() + 1, mips::RegisterSet());
+    live.back().set();
+    bool changed;
+    do{
+        changed = false;
+        for (size_t i = code->size(); i-- > 0; ){
+            const mips::MachineInstruction &inst = (*code)[i];
+            mips::RegisterSet in;
+            if (inst.isCall())
+                in.set();
+            else{
+                for (size_t succ : getSuccessors(i))
+                    in |= live[succ];
+                in = (in & ~inst.getDefs()) | inst.getUses();
+            }
+            if (in != live[i]){
+                live[i] = in;
+                changed = true;
+            }
+        }
+    } while (changed);
+}
+
+std::vector<size_t> DelaySlotFiller::getSuccessors(size_t pos) const
+{
+    // control instruction with filled slot continues with it, the slot then goes where
+    // the control instruction does
+    size_t branch = slot[pos] ? pos - 1 : pos;
+    const mips::MachineInstruction &inst = (*code)[branch];
+    if (branch == pos && hasDelaySlot(inst) && pos + 1 < code->size() && slot[pos + 1])
+        return {pos + 1};
+
+    std::vector<size_t> succ;
+    if (inst.getOpcode() == mips::Opcode::JR || inst.getOpcode() == mips::Opcode::BREAK)
+        return {code->size()};
+    if (!inst.getTarget().empty() && !inst.isCall()){
+        auto itr = labels.find(inst.getTarget());
+        succ.push_back(itr != labels.end() ? itr->second : code->size());
+    }
+    if (!inst.isUnconditionalJump())
+        succ.push_back(pos + 1);
+    return succ;
+}
+
+size_t DelaySlotFiller::findInstruction(size_t pos) const
+{
+    while (pos < code->size() && ((*code)[pos].isLabel() || (*code)[pos].isComment()))
+        pos++;
+    return pos;
+}
+
+// independent instruction of the same block is moved behind the jump
+bool DelaySlotFiller::fillFromBefore(size_t pos)
+{
+    const mips::MachineInstruction &jump = (*code)[pos];
+    std::vector<size_t> between;
+    for (size_t k = pos; k-- > 0; ){
+        const mips::MachineInstruction &inst = (*code)[k];
+        if (inst.isComment() || (inst.isLabel() && !targets.count(inst.getText())))
+            continue;
+        if (inst.isLabel() || hasDelaySlot(inst) || inst.isUnconditionalJump() || slot[k])
+            return false;
+
+        // jal writes $ra before its slot is executed
+        bool independent = fitsSlot(inst) && !inst.conflictsWith(jump)
+                && !(jump.isCall() && (inst.getDefs() | inst.getUses()).test(ReturnAddress));
+        for (size_t i = 0; independent && i < between.size(); i++)
+            independent = !inst.conflictsWith((*code)[between[i]]);
+
+        if (independent){
+            mips::MachineInstruction moved = inst;
+            erase(k);
+            insert(pos, moved, true);
+            filled[BEFORE]++;
+            return true;
+        }
+        between.push_back(k);
+    }
+    return false;
+}
+
+// first instruction of the target is copied into the slot and the jump goes behind it;
+// a branch executes it on the fallthrough path too, so its result has to be dead there
+bool DelaySlotFiller::fillFromTarget(size_t pos)
+{
+    const std::string target = (*code)[pos].getTarget();
+    auto itr = labels.find(target);
+    if (itr == labels.end())
+        return false;
+
+    size_t first = findInstruction(itr->second);
+    if (first == code->size() || !fitsSlot((*code)[first]))
+        return false;
+    if ((*code)[pos].isConditionalBranch()
+            && (!isSpeculable((*code)[first]) || ((*code)[first].getDefs() & live[pos + 1]).any()))
+        return false;
+
+    mips::MachineInstruction copy = (*code)[first];
+    const std::string name = target + "$slot";
+    auto label = labels.find(name);
+    if (label == labels.end()){
+        insert(first + 1, mips::MachineInstruction::label(name), false);
+        labels[name] = first + 1;
+        targets.insert(name);
+        if (first < pos)
+            pos++;
+    } else if (label->second != first + 1)
+        return false;
+
+    insert(pos + 1, copy, true);
+    (*code)[pos].getOperands().back() = mips::Operand::label(name);
+    filled[TARGET]++;
+    return true;
+}
+
+// instruction following a branch is moved into its slot if its result is dead at the target
+bool DelaySlotFiller::fillFromFallthrough(size_t pos)
+{
+    auto itr = labels.find((*code)[pos].getTarget());
+    if (itr == labels.end())
+        return false;
+
+    size_t next = pos + 1;
+    while (next < code->size() && ((*code)[next].isComment() || ((*code)[next].isLabel() && !targets.count((*code)[next].getText()))))
+        next++;
+    if (next == code->size() || !fitsSlot((*code)[next]) || !isSpeculable((*code)[next])
+            || ((*code)[next].getDefs() & live[itr->second]).any())
+        return false;
+
+    mips::MachineInstruction moved = (*code)[next];
+    erase(next);
+    insert(pos + 1, moved, true);
+    filled[FALLTHROUGH]++;
+    return true;
+}
+
+} // namespace backend
@@ -0,0 +1,68 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#ifndef DELAYSLOTFILLER_H
+#define DELAYSLOTFILLER_H
+
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "backend/machineinstruction.h"
+
+
+namespace backend{
+
+/**
+ * Fills branch delay slots of the final machine code for targets executing the instruction
+ * behind a jump, branch or call (the code is then printed in .set noreorder mode).
+ *
+ * A slot is filled with an independent instruction preceding the jump in its block. For
+ * branches, the first instruction of the target (for b and j also) or of the fallthrough
+ * path is used if it cannot trap and its result is dead on the other path; nop is left
+ * when nothing fits. Statistics are collected over all functions.
+ */
+class DelaySlotFiller
+{
+public:
+    enum Source { BEFORE, TARGET, FALLTHROUGH, NOP, SOURCE_COUNT };
+
+    DelaySlotFiller();
+
+    void run(std::vector<mips::MachineInstruction> &code);
+
+    // assembly comments with number of slots filled from each source
+    const std::string getStatistics() const;
+
+private:
+    unsigned filled[SOURCE_COUNT];
+    std::vector<mips::MachineInstruction> *code;
+    std::vector<bool> slot;                 // instruction is in the delay slot of the previous one
+    std::set<std::string> targets;          // labels jumped to
+    std::map<std::string, size_t> labels;   // label -> index
+    std::vector<mips::RegisterSet> live;    // registers live before each instruction
+
+    static bool hasDelaySlot(const mips::MachineInstruction &inst);
+    static bool fitsSlot(const mips::MachineInstruction &inst);
+    // instruction can be executed on a path it was not on, it cannot trap or change memory
+    static bool isSpeculable(const mips::MachineInstruction &inst);
+
+    void insert(size_t pos, const mips::MachineInstruction &inst, bool isSlot);
+    void erase(size_t pos);
+    void analyze();
+    // instructions executed after pos when control leaves the instruction at pos, the end of
+    // the function is represented by code size
+    std::vector<size_t> getSuccessors(size_t pos) const;
+    size_t findInstruction(size_t pos) const;
+
+    bool fillFromBefore(size_t pos);
+    bool fillFromTarget(size_t pos);
+    bool fillFromFallthrough(size_t pos);
+};
+
+} // namespace backend
+
+#endif // DELAYSLOTFILLER_H
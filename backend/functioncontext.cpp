@@ -3,21 +3,40 @@
  * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
  **/
 
+#include <algorithm>
+
 #include "functioncontext.h"
 #include "ir/function.h"
 #include "backend/asmgenerator.h"
+#include "backend/blocklayout.h"
 
 
 namespace backend{
 
 extern const std::string Indent = "        ";
 
+namespace {
+
+// caller saved registers taken from the allocator of a leaf function for its locals
+const unsigned MaxTemporaryHomes = 4;
+
+bool isLeafValue(const ir::Value *val)
+{
+    if (val->getDataType() == ir::Value::DataType::STRING)
+        return false;
+    const ir::NamedValue *named = dynamic_cast<const ir::NamedValue*>(val);
+    return named == nullptr || !named->isArray();
+}
+
+} // anonymous namespace
+
 
 FunctionContext::FunctionContext(ir::Function *func, ASMgenerator *parent, const mips::MIPS *mips)
 {
     this->func = func;
     this->mips = mips;
     this->parent = parent;
+    liveness.run(func);
 }
 
 BlockContext *FunctionContext::Active() const
@@ -35,6 +54,18 @@ void FunctionContext::addBlock(const ir::BasicBlock *block)
         }
     }
     blockContextTable.emplace_back(std::move(BlockContext(this, block)));
+
+    // parameters are in their registers only when the entry block is entered from the caller
+    if (block == func->getEntryBasicBlock()){
+        bool fromCaller = const_cast<ir::BasicBlock*>(block)->getPredecessors().empty();
+        for (auto &param : registerParams){
+            if (fromCaller)
+                blockContextTable.back().addParamRegister(param.first, param.second);
+            else
+                EntryCode.emplace_back(mips::Opcode::SW, std::vector<mips::Operand>{mips::Operand::reg(*param.second),
+                                       mips::Operand::mem(-getVarOffset(*param.first), mips->getFramePointer())});
+        }
+    }
 }
 
 void FunctionContext::setActiveBlock(const ir::BasicBlock *block)
@@ -61,13 +92,82 @@ const BlockContext *FunctionContext::getBlockContext(const ir::BasicBlock *block
     return nullptr;
 }
 
+bool FunctionContext::makeLeaf()
+{
+    // strings and arrays call runtime routines or need stack, so do user functions
+    std::vector<const ir::Value*> locals;
+    const std::vector<ir::Value*> &params = func->getParameters();
+    for (ir::BasicBlock *block : const_cast<ir::Function*>(func)->getBasicBlocks()){
+        for (ir::Instruction *inst : block->getInstructions()){
+            if (dynamic_cast<ir::CallInstruction*>(inst) || dynamic_cast<ir::LoadIndexedInstruction*>(inst)
+                    || dynamic_cast<ir::StoreIndexedInstruction*>(inst))
+                return false;
+
+            std::vector<ir::Value*> values = ir::getInstructionOperands(inst);
+            if (ir::ResultInstruction *result = dynamic_cast<ir::ResultInstruction*>(inst))
+                values.push_back(result->getResult());
+            if (ir::DeclarationInstruction *decl = dynamic_cast<ir::DeclarationInstruction*>(inst))
+                values.push_back(decl->getOperand());
+
+            for (ir::Value *val : values){
+                if (val == nullptr)
+                    continue;
+                if (!isLeafValue(val))
+                    return false;
+                if (val->getType() == ir::Value::Type::NAMED && std::find(params.begin(), params.end(), val) == params.end()
+                        && std::find(locals.begin(), locals.end(), val) == locals.end())
+                    locals.push_back(val);
+            }
+        }
+    }
+
+    // parameters stay in registers they are passed in, locals get the remaining ones
+    // and a few caller saved registers, which are safe as nothing is called
+    const std::vector<const mips::Register*> &paramRegs = mips->getParamRegisters();
+    const std::vector<const mips::Register*> &callerSaved = mips->getCallerSavedRegisters();
+    if (params.size() > paramRegs.size() || locals.size() > paramRegs.size() - params.size() + MaxTemporaryHomes)
+        return false;
+    for (ir::Value *param : params){
+        if (!isLeafValue(param))
+            return false;
+    }
+
+    for (size_t i = 0; i < params.size(); i++)
+        homes[params[i]] = paramRegs[i];
+    for (size_t i = 0; i < locals.size(); i++){
+        size_t reg = params.size() + i;
+        homes[locals[i]] = reg < paramRegs.size() ? paramRegs[reg] : callerSaved[callerSaved.size() - 1 - (reg - paramRegs.size())];
+    }
+    leaf = true;
+    return true;
+}
+
+const mips::Register *FunctionContext::getHome(const ir::Value *var) const
+{
+    auto itr = homes.find(var);
+    return itr != homes.end() ? itr->second : nullptr;
+}
+
+bool FunctionContext::isHomeRegister(const mips::Register *reg) const
+{
+    for (auto &it : homes){
+        if (it.second == reg)
+            return true;
+    }
+    return false;
+}
+
 void FunctionContext::addVar(ir::NamedValue &var)
 {
     //if aleady on stack
     if (varToStackTable.find(&var) != varToStackTable.end()) return;
+    if (const mips::Register *home = getHome(&var)){
+        EntryCode.push_back(mips::MachineInstruction::comment("  #Variable " + var.getName() + " is kept in register " + home->getAsmName()));
+        return;
+    }
 
     varToStackTable[&var] = stackCounter;
-    EntryCode << Indent << "  #Variable " << var.getName() << " got offset: " << stackCounter << " ... " << -stackCounter << "($fp)" << "\n";
+    EntryCode.push_back(mips::MachineInstruction::comment("  #Variable " + var.getName() + " got offset: " + std::to_string(stackCounter) + " ... " + std::to_string(-stackCounter) + "($fp)"));
     stackCounter += 4; // add stack offset, 4 bytes
 }
 
@@ -75,6 +175,11 @@ void FunctionContext::addVar(ir::NamedValue &var, unsigned paramPos)
 {
     unsigned maxRegisterParams = mips->getParamRegisters().size();
 
+    if (getHome(&var) != nullptr){
+        addVar(var);
+        return;
+    }
+
     bool regMapped = false;
     if (paramPos < maxRegisterParams){
         regMapped = true;
@@ -86,13 +191,13 @@ void FunctionContext::addVar(ir::NamedValue &var, unsigned paramPos)
         addVar(var); // asign variable a stack place
         const int localOffset = getVarOffset(var);
         const mips::Register *src = mips->getParamRegisters()[paramPos]; // first param has position 0
-        EntryCode << Indent << "  #Variable " << var.getName() << " is transfered through register" << "\n";
-        EntryCode << Indent << "sw " +  src->getAsmName() << ", " << -localOffset << "($fp)"  << "\n";
-        instrSize += 4;
+        // stored by the entry block only if the register is needed or the block is left
+        EntryCode.push_back(mips::MachineInstruction::comment("  #Variable " + var.getName() + " is transfered through register " + src->getAsmName() + ", stack place " + std::to_string(-localOffset) + "($fp)"));
+        registerParams.push_back(std::make_pair(&var, src));
     } else {
         int fpOffBytes = 4 + 4 * ((paramPos+1)-maxRegisterParams);
         varToStackTable[&var] = -fpOffBytes; // negative because stack is top-down
-        EntryCode << Indent << "  #Variable " << var.getName() << " got stack posiotion " <<fpOffBytes << "($fp)\n";
+        EntryCode.push_back(mips::MachineInstruction::comment("  #Variable " + var.getName() + " got stack posiotion " + std::to_string(fpOffBytes) + "($fp)"));
         /*
         // copy from stack to local stack using PARAMregister 0
         const mips::Register *src = mips->getParamRegisters()[0];
@@ -122,50 +227,125 @@ int FunctionContext::getVarOffset(ir::NamedValue &var)
     //}
 }
 
-const std::stringstream FunctionContext::getInstructions()
+void FunctionContext::reserveCallArea(unsigned stackArgs, bool saveGP)
 {
-    std::stringstream instr, epilog;
+    outgoingArgs = std::max(outgoingArgs, (int)stackArgs * 4);
+    gpSaveSlot |= saveGP;
+}
 
-    int localInstrCounter = 0;
+int FunctionContext::getCallAreaSize() const
+{
+    return outgoingArgs + (gpSaveSlot ? 4 : 0);
+}
 
-    instr << func->getName() + " :      #FUNCTION LABEL\n";              // label
-    instr << mips->getFunctionPrologue();
-    localInstrCounter += 16;
+void FunctionContext::addArray(ir::NamedValue &array)
+{
+    //if aleady on stack
+    if (arrayToStackTable.find(&array) != arrayToStackTable.end()) return;
 
-    instr << Indent << "#local vars: "<< varToStackTable.size() << "\n";
-    instr << Indent << "#spilled vars: "<< spillTable.size() << "\n";
-    instr << Indent << "#Make place for local + spilled \n";
-    instr << Indent << "addi $sp, $sp, " << -(stackCounter-4) << " \n" ;
-    localInstrCounter += 4;
-    instr << EntryCode.rdbuf()->str();
+    arrayToStackTable[&array] = arrayCounter;
+    EntryCode.push_back(mips::MachineInstruction::comment("  #Array " + array.getName() + " got offset: " + std::to_string(getCallAreaSize() + arrayCounter) + "($sp)"));
+    arrayCounter += getArrayBytes(array);
+}
 
-    epilog << func->getName() + "_$return:\n";
-    epilog << Indent << "#restore callee saved registers\n";
+int FunctionContext::getArrayOffset(ir::NamedValue &array)
+{
+    addArray(array);
+    return getCallAreaSize() + arrayToStackTable.at(&array);
+}
 
-    // callee saved registers SAVING place
-    instr << Indent <<  "#callee saved registers\n";
-    instr << Indent <<  "addi $sp, $sp, " << -(int)calleeSavedSet.size()*4 << " \n" ;
-    localInstrCounter += 4;
-    int offset = 0;
-    for ( auto & item : calleeSavedSet)
-    {
-        instr << Indent <<  "sw " + item->getAsmName()  << ", " <<  -(int)(offset+stackCounter) <<"($fp)" << " \n" ;
-        epilog << Indent << "lw " + item->getAsmName()  << ", " <<  -(int)(offset+stackCounter) <<"($fp)" << " \n" ;
-        offset += 4;
-        localInstrCounter += 8;
-    }
+int FunctionContext::getArrayElementSize(const ir::NamedValue &array)
+{
+    return array.getDataType() == ir::Value::DataType::CHAR ? 1 : 4;
+}
+
+int FunctionContext::getArrayBytes(const ir::NamedValue &array)
+{
+    // keep the words aligned
+    return (array.getArraySize() * getArrayElementSize(array) + 3) & ~3;
+}
 
+bool FunctionContext::needsFrame() const
+{
+    // stackCounter grows with every variable or temporary which got a stack slot
+    return !leaf || stackCounter > 4 || !calleeSavedSet.empty() || arrayCounter > 0 || getCallAreaSize() > 0;
+}
 
-    for(auto const &it : blockContextTable){
-        instr <<  it.getInstructions();
+const std::vector<mips::MachineInstruction> FunctionContext::getCode() const
+{
+    std::vector<mips::MachineInstruction> code, epilog;
+    const mips::Register &sp = mips->getStackPointer();
+    const mips::Register &fp = mips->getFramePointer();
+    const std::string returnLabel = func->getName() + "_$return";
+    const bool frame = needsFrame();
+
+    code.push_back(mips::MachineInstruction::label(func->getName()));
+    if (!frame){
+        code.push_back(mips::MachineInstruction::comment("#leaf function without frame"));
+        code.insert(code.end(), EntryCode.begin(), EntryCode.end());
+    } else {
+        mips->getFunctionPrologue(code);
+
+        code.push_back(mips::MachineInstruction::comment("#local vars: " + std::to_string(varToStackTable.size())));
+        code.push_back(mips::MachineInstruction::comment("#spilled vars: " + std::to_string(spillTable.size())));
+        code.push_back(mips::MachineInstruction::comment("#Make place for local + spilled"));
+        code.emplace_back(mips::Opcode::ADDI, std::vector<mips::Operand>{mips::Operand::reg(sp), mips::Operand::reg(sp), mips::Operand::imm(-(stackCounter-4))});
+        code.insert(code.end(), EntryCode.begin(), EntryCode.end());
+
+        epilog.push_back(mips::MachineInstruction::comment("#restore callee saved registers"));
+
+        // callee saved registers SAVING place
+        code.push_back(mips::MachineInstruction::comment("#callee saved registers"));
+        code.emplace_back(mips::Opcode::ADDI, std::vector<mips::Operand>{mips::Operand::reg(sp), mips::Operand::reg(sp), mips::Operand::imm(-(int)calleeSavedSet.size()*4)});
+        int offset = 0;
+        for ( auto & item : calleeSavedSet)
+        {
+            code.emplace_back(mips::Opcode::SW, std::vector<mips::Operand>{mips::Operand::reg(*item), mips::Operand::mem(-(int)(offset+stackCounter), fp)});
+            epilog.emplace_back(mips::Opcode::LW, std::vector<mips::Operand>{mips::Operand::reg(*item), mips::Operand::mem(-(int)(offset+stackCounter), fp)});
+            offset += 4;
+        }
+
+        int bottom = arrayCounter + getCallAreaSize();
+        if (bottom > 0)
+        {
+            code.push_back(mips::MachineInstruction::comment("#arrays: " + std::to_string(arrayToStackTable.size()) + ", call area: " + std::to_string(getCallAreaSize())));
+            if (bottom <= 32768)
+            {
+                code.emplace_back(mips::Opcode::ADDI, std::vector<mips::Operand>{mips::Operand::reg(sp), mips::Operand::reg(sp), mips::Operand::imm(-bottom)});
+            }
+            else
+            {
+                const mips::Register &scratch = *mips->getRetRegister();
+                code.emplace_back(mips::Opcode::LI, std::vector<mips::Operand>{mips::Operand::reg(scratch), mips::Operand::imm(bottom)});
+                code.emplace_back(mips::Opcode::SUB, std::vector<mips::Operand>{mips::Operand::reg(sp), mips::Operand::reg(sp), mips::Operand::reg(scratch)});
+            }
+        }
+        mips->getFunctionEpilogue(epilog);
     }
 
-    instr << epilog.str() << mips->getFunctionEpilogue();
-    localInstrCounter += 20;
+    std::vector<const ir::BasicBlock*> blocks;
+    for(auto const &it : blockContextTable)
+        blocks.push_back(it.getBlock());
+
+    BlockLayout layout(func, blocks);
+    for(auto block : layout.getOrder()){
+        const BlockContext *context = getBlockContext(block);
+        code.push_back(mips::MachineInstruction::label(context->getName()));
+        for (auto &inst : context->getCode()){
+            // without epilogue there is nothing to jump to, return directly
+            if (!frame && inst.getOpcode() == mips::Opcode::J && inst.getTarget() == returnLabel)
+                code.emplace_back(mips::Opcode::JR, std::vector<mips::Operand>{mips::Operand::reg(mips->getRAPointer())});
+            else
+                code.push_back(inst);
+        }
+    }
 
-    instrSize += localInstrCounter;
+    code.push_back(mips::MachineInstruction::label(returnLabel));
+    if (!frame)
+        code.emplace_back(mips::Opcode::JR, std::vector<mips::Operand>{mips::Operand::reg(mips->getRAPointer())});
+    code.insert(code.end(), epilog.begin(), epilog.end());
 
-    return instr;
+    return code;
 }
 
 const mips::MIPS *FunctionContext::getMips() const
@@ -226,15 +406,6 @@ ConstStringData &FunctionContext::getStringTable()
     return parent->getStringTable();
 }
 
-void FunctionContext::addInstrSize(int size)
-{
-    instrSize += size;
-}
-
-unsigned FunctionContext::getInstrSize()
-{
-    return instrSize;
-}
 
 
 }// namespace end
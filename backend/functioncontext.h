@@ -14,8 +14,10 @@
 #include "ir/value.h"
 #include "ir/instruction.h"
 #include "ir/basic_block.h"
+#include "ir/liveness.h"
 #include "backend/blockcontext.h"
 #include "backend/mips.h"
+#include "backend/machineinstruction.h"
 #include "backend/conststringdata.h"
 
 
@@ -39,11 +41,35 @@ public:
     void setActiveBlock(const ir::BasicBlock *block);
     const BlockContext *getBlockContext(const ir::BasicBlock *block) const;
 
+    // leaf function without strings and arrays keeps its variables in home registers for
+    // the whole function, parameters in the ones they are passed in; has to be decided
+    // before parameters and blocks are added
+    bool makeLeaf();
+    bool isLeaf() const {return leaf;}
+    // register the variable lives in, nullptr if it is kept on stack
+    const mips::Register *getHome(const ir::Value *var) const;
+    bool isHomeRegister(const mips::Register *reg) const;
+
     void addVar(ir::NamedValue &var);
     void addVar(ir::NamedValue &var, unsigned paramPos);
     const ir::Function *getFunction() const;
     int getVarOffset(ir::NamedValue &var);
-    const std::stringstream getInstructions();
+    // values live after IR instructions, decides which parameters have to be stored
+    const ir::Liveness &getLiveness() const {return liveness;}
+
+    // area at the bottom of the frame for arguments passed on stack and $gp saved over
+    // a call, sized for the largest call before the code is generated
+    void reserveCallArea(unsigned stackArgs, bool saveGP);
+    int getCallAreaSize() const;
+    int getGPSaveOffset() const {return outgoingArgs;}
+
+    // arrays live above the call area and are addressed relative to $sp
+    void addArray(ir::NamedValue &array);
+    int getArrayOffset(ir::NamedValue &array);
+    static int getArrayElementSize(const ir::NamedValue &array);
+    static int getArrayBytes(const ir::NamedValue &array);
+    // whole code of the function including prologue and epilogue
+    const std::vector<mips::MachineInstruction> getCode() const;
     const mips::MIPS *getMips() const;
     void testCalleeSaved(const mips::Register * reg);
 
@@ -54,27 +80,33 @@ public:
     void cleanspillTable();
 
     ConstStringData &getStringTable();
-    void addInstrSize(int size);
-    unsigned getInstrSize();
 
 private:
     std::map<ir::NamedValue*, int> varToStackTable; // map a NamedValue to its place on stack
+    std::map<ir::NamedValue*, int> arrayToStackTable; // map an array to its offset from $sp
+    std::map<const ir::Value*, const mips::Register*> homes; // variables of leaf function kept in registers
+    std::vector<std::pair<ir::NamedValue*, const mips::Register*>> registerParams; // parameters passed in registers
+    ir::Liveness liveness;
     std::vector<spillItem> spillTable;
     std::vector<BlockContext> blockContextTable;
     BlockContext *activeBlock;
 
     int stackCounter = 4; // start on 4 because at 0 there is previous FP
+    int arrayCounter = 0; // size of the array area below callee saved registers
+    int outgoingArgs = 0; // bytes of stack arguments of the largest call
+    bool gpSaveSlot = false;
+    bool leaf = false;
 
     const ir::Function *func;   // function this context is joined to
-    std::stringstream EntryCode; // this will be appended to code right after MIPS function entry
+    std::vector<mips::MachineInstruction> EntryCode; // this will be appended to code right after MIPS function entry
     std::set<const mips::Register*> calleeSavedSet; // set of registers a function has to preserve
 
+    // leaf function which spills nothing does not need $ra, $fp nor any stack
+    bool needsFrame() const;
 
     const mips::MIPS *mips;
     ASMgenerator *parent;
 
-    unsigned instrSize = 0;
-
 };
 
 } // namespace backend
@@ -0,0 +1,514 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#include <climits>
+#include <cstdint>
+
+#include "instructionselector.h"
+
+
+namespace backend{
+
+namespace {
+
+struct RuleText{
+    const char *lhs;
+    const char *pattern;
+    int cost;
+    const char *code;
+};
+
+// Cost is the number of emitted instructions. In code templates %d is the result register,
+// %s is scratch $2, %a, %b, ... are leaves of the pattern in order, #a is the constant leaf
+// (#a+1 and #-a adjusted), %T and %F are the true and false targets of the jump.
+// Arithmetic traps on overflow whether the operand is a register or a constant.
+const RuleText ruleTable[] = {
+    { "reg",  "(add reg reg)",             1, "ADD %d, %a, %b" },
+    { "reg",  "(add reg imm)",             1, "ADDI %d, %a, #b" },
+    { "reg",  "(sub reg reg)",             1, "SUB %d, %a, %b" },
+    { "reg",  "(sub reg -imm)",            1, "ADDI %d, %a, #-b" },
+    { "reg",  "(and reg reg)",             1, "AND %d, %a, %b" },
+    { "reg",  "(and reg uimm)",            1, "ANDI %d, %a, #b" },
+    { "bool", "(and bool bool)",           1, "AND %d, %a, %b" },
+    { "reg",  "(or reg reg)",              1, "OR %d, %a, %b" },
+    { "reg",  "(or reg uimm)",             1, "ORI %d, %a, #b" },
+    { "bool", "(or bool bool)",            1, "OR %d, %a, %b" },
+    { "reg",  "(xor reg reg)",             1, "XOR %d, %a, %b" },
+    { "reg",  "(xor reg uimm)",            1, "XORI %d, %a, #b" },
+    { "bool", "(xor bool bool)",           1, "XOR %d, %a, %b" },
+
+    { "bool", "(lt reg reg)",              1, "SLT %d, %a, %b" },
+    { "bool", "(lt reg imm)",              1, "SLTI %d, %a, #b" },
+    { "bool", "(gt reg reg)",              1, "SLT %d, %b, %a" },
+    { "bool", "(gt reg imm+1)",            2, "SLTI %d, %a, #b+1; XORI %d, %d, 1" },
+    { "bool", "(le reg reg)",              2, "SLT %d, %b, %a; XORI %d, %d, 1" },
+    { "bool", "(le reg imm+1)",            1, "SLTI %d, %a, #b+1" },
+    { "bool", "(ge reg reg)",              2, "SLT %d, %a, %b; XORI %d, %d, 1" },
+    { "bool", "(ge reg imm)",              2, "SLTI %d, %a, #b; XORI %d, %d, 1" },
+    { "bool", "(eq reg reg)",              2, "XOR %d, %a, %b; SLTIU %d, %d, 1" },
+    { "bool", "(eq reg zero)",             1, "SLTIU %d, %a, 1" },
+    { "bool", "(eq reg -imm)",             2, "ADDIU %d, %a, #-b; SLTIU %d, %d, 1" },
+    { "bool", "(eq reg uimm)",             2, "XORI %d, %a, #b; SLTIU %d, %d, 1" },
+    { "bool", "(ne reg reg)",              2, "XOR %d, %a, %b; SLTU %d, $0, %d" },
+    { "bool", "(ne reg zero)",             1, "SLTU %d, $0, %a" },
+    { "bool", "(ne reg -imm)",             2, "ADDIU %d, %a, #-b; SLTU %d, $0, %d" },
+    { "bool", "(ne reg uimm)",             2, "XORI %d, %a, #b; SLTU %d, $0, %d" },
+
+    { "bool", "(not reg)",                 1, "SLTIU %d, %a, 1" },
+    { "bool", "(not bool)",                1, "XORI %d, %a, 1" },
+    { "bool", "(not (le reg reg))",        1, "SLT %d, %b, %a" },
+    { "bool", "(not (ge reg reg))",        1, "SLT %d, %a, %b" },
+    { "bool", "(not (ge reg imm))",        1, "SLTI %d, %a, #b" },
+    { "bool", "(not (gt reg imm+1))",      1, "SLTI %d, %a, #b+1" },
+    { "bool", "(not (eq reg reg))",        2, "XOR %d, %a, %b; SLTU %d, $0, %d" },
+    { "bool", "(not (ne reg reg))",        2, "XOR %d, %a, %b; SLTIU %d, %d, 1" },
+    { "bool", "(land reg reg)",            3, "SLTU %s, $0, %a; SLTU %d, $0, %b; AND %d, %d, %s" },
+    { "bool", "(land bool reg)",           2, "SLTU %d, $0, %b; AND %d, %d, %a" },
+    { "bool", "(land reg bool)",           2, "SLTU %d, $0, %a; AND %d, %d, %b" },
+    { "bool", "(land bool bool)",          1, "AND %d, %a, %b" },
+    { "bool", "(lor reg reg)",             2, "OR %d, %a, %b; SLTU %d, $0, %d" },
+    { "bool", "(lor bool bool)",           1, "OR %d, %a, %b" },
+    { "reg",  "bool",                      0, "" },
+
+    { "stmt", "(cjump reg)",               2, "BNE %a, $0, %T; B %F" },
+    { "stmt", "(cjump (not reg))",         2, "BEQ %a, $0, %T; B %F" },
+    { "stmt", "(cjump (eq reg reg))",      2, "BEQ %a, %b, %T; B %F" },
+    { "stmt", "(cjump (ne reg reg))",      2, "BNE %a, %b, %T; B %F" },
+    { "stmt", "(cjump (not (eq reg reg)))", 2, "BNE %a, %b, %T; B %F" },
+    { "stmt", "(cjump (not (ne reg reg)))", 2, "BEQ %a, %b, %T; B %F" },
+    { "stmt", "(cjump (lt reg zero))",     2, "BLTZ %a, %T; B %F" },
+    { "stmt", "(cjump (le reg zero))",     2, "BLEZ %a, %T; B %F" },
+    { "stmt", "(cjump (gt reg zero))",     2, "BGTZ %a, %T; B %F" },
+    { "stmt", "(cjump (ge reg zero))",     2, "BGEZ %a, %T; B %F" },
+    { "stmt", "(cjump (not (lt reg zero)))", 2, "BGEZ %a, %T; B %F" },
+    { "stmt", "(cjump (not (le reg zero)))", 2, "BGTZ %a, %T; B %F" },
+    { "stmt", "(cjump (not (gt reg zero)))", 2, "BLEZ %a, %T; B %F" },
+    { "stmt", "(cjump (not (ge reg zero)))", 2, "BLTZ %a, %T; B %F" },
+    { "stmt", "(cjump (le reg reg))",      3, "SLT %s, %b, %a; BEQ %s, $0, %T; B %F" },
+    { "stmt", "(cjump (ge reg reg))",      3, "SLT %s, %a, %b; BEQ %s, $0, %T; B %F" },
+    { "stmt", "(cjump (gt reg imm+1))",    3, "SLTI %s, %a, #b+1; BEQ %s, $0, %T; B %F" },
+    { "stmt", "(cjump (ge reg imm))",      3, "SLTI %s, %a, #b; BEQ %s, $0, %T; B %F" },
+};
+
+const int InfiniteCost = INT_MAX / 4;
+
+// int and char constants may be encoded as immediate operands
+bool constantValue(ir::Value *value, int &imm)
+{
+    if (value->getType() != ir::Value::Type::CONSTANT)
+        return false;
+
+    if (value->getDataType() == ir::Value::DataType::INT)
+        imm = static_cast<ir::ConstantValue<int>*>(value)->getConstantValue();
+    else if (value->getDataType() == ir::Value::DataType::CHAR)
+        imm = static_cast<ir::ConstantValue<char>*>(value)->getConstantValue();
+    else
+        return false;
+    return true;
+}
+
+bool fitsSigned16(int64_t value)
+{
+    return value >= -32768 && value <= 32767;
+}
+
+bool fitsUnsigned16(int64_t value)
+{
+    return value >= 0 && value <= 0xFFFF;
+}
+
+std::string readToken(const std::string &text, size_t &pos)
+{
+    while (pos < text.size() && text[pos] == ' ')
+        pos++;
+    size_t start = pos;
+    while (pos < text.size() && text[pos] != ' ' && text[pos] != '(' && text[pos] != ')')
+        pos++;
+    return text.substr(start, pos - start);
+}
+
+} // anonymous namespace
+
+InstructionSelector::InstructionSelector()
+{
+    static const std::map<std::string, NonTerminal> nonTerminals = {
+        { "reg", REG }, { "bool", BOOL }, { "stmt", STMT }
+    };
+
+    for (const RuleText &text : ruleTable){
+        Rule rule;
+        size_t pos = 0;
+        rule.lhs = nonTerminals.at(text.lhs);
+        rule.pattern = parsePattern(text.pattern, pos);
+        rule.cost = text.cost;
+
+        std::string code = text.code;
+        for (size_t start = 0; start < code.size(); ){
+            size_t end = code.find("; ", start);
+            if (end == std::string::npos)
+                end = code.size();
+            rule.code.push_back(parseTemplate(code.substr(start, end - start)));
+            start = end + 2;
+        }
+        rules.push_back(rule);
+    }
+}
+
+InstructionSelector::~InstructionSelector()
+{
+
+}
+
+InstructionSelector::Template InstructionSelector::parseTemplate(const std::string &line)
+{
+    Template result;
+    size_t space = line.find(' ');
+    if (!mips::findOpcode(line.substr(0, space), result.opcode))
+        throw std::string("unknown instruction in selector rule: " + line);
+
+    for (size_t pos = space + 1; pos < line.size(); ){
+        size_t end = line.find(", ", pos);
+        if (end == std::string::npos)
+            end = line.size();
+        result.operands.push_back(line.substr(pos, end - pos));
+        pos = end + 2;
+    }
+    return result;
+}
+
+InstructionSelector::Pattern InstructionSelector::parsePattern(const std::string &text, size_t &pos)
+{
+    static const std::map<std::string, Op> ops = {
+        { "add", Op::ADD }, { "sub", Op::SUB }, { "and", Op::AND }, { "or", Op::OR }, { "xor", Op::XOR },
+        { "lt", Op::LESS }, { "le", Op::LESS_EQUAL }, { "gt", Op::GREATER }, { "ge", Op::GREATER_EQUAL },
+        { "eq", Op::EQUAL }, { "ne", Op::NOT_EQUAL }, { "land", Op::LOGICAL_AND }, { "lor", Op::LOGICAL_OR },
+        { "not", Op::NOT }, { "cjump", Op::COND_JUMP }
+    };
+    static const std::map<std::string, Leaf> leaves = {
+        { "reg", Leaf::REG }, { "bool", Leaf::BOOL }, { "zero", Leaf::ZERO }, { "imm", Leaf::IMM },
+        { "uimm", Leaf::UIMM }, { "imm+1", Leaf::IMM_PLUS_ONE }, { "-imm", Leaf::NEG_IMM }
+    };
+
+    Pattern pattern;
+    while (pos < text.size() && text[pos] == ' ')
+        pos++;
+
+    if (text[pos] != '('){
+        pattern.op = Op::LEAF;
+        pattern.leaf = leaves.at(readToken(text, pos));
+        return pattern;
+    }
+
+    pos++;
+    pattern.op = ops.at(readToken(text, pos));
+    pattern.leaf = Leaf::NONE;
+    while (true){
+        while (pos < text.size() && text[pos] == ' ')
+            pos++;
+        if (text[pos] == ')')
+            break;
+        pattern.kids.push_back(parsePattern(text, pos));
+    }
+    pos++;
+    return pattern;
+}
+
+InstructionSelector::Op InstructionSelector::getOp(ir::Instruction *inst)
+{
+    if (dynamic_cast<ir::CondJumpInstruction*>(inst))
+        return Op::COND_JUMP;
+    if (dynamic_cast<ir::NotInstruction*>(inst))
+        return Op::NOT;
+    if (dynamic_cast<ir::AddInstruction*>(inst))
+        return Op::ADD;
+    if (dynamic_cast<ir::SubtractInstruction*>(inst))
+        return Op::SUB;
+    if (dynamic_cast<ir::BitwiseAndInstruction*>(inst))
+        return Op::AND;
+    if (dynamic_cast<ir::BitwiseOrInstruction*>(inst))
+        return Op::OR;
+    if (dynamic_cast<ir::BitwiseXorInstruction*>(inst))
+        return Op::XOR;
+    if (dynamic_cast<ir::AndInstruction*>(inst))
+        return Op::LOGICAL_AND;
+    if (dynamic_cast<ir::OrInstruction*>(inst))
+        return Op::LOGICAL_OR;
+
+    // strings are compared by runtime routines
+    ir::BinaryInstruction *binary = dynamic_cast<ir::BinaryInstruction*>(inst);
+    if (binary == nullptr || binary->getLeftOperand()->getDataType() == ir::Value::DataType::STRING)
+        return Op::LEAF;
+
+    if (dynamic_cast<ir::LessInstruction*>(inst))
+        return Op::LESS;
+    if (dynamic_cast<ir::LessEqualInstruction*>(inst))
+        return Op::LESS_EQUAL;
+    if (dynamic_cast<ir::GreaterInstruction*>(inst))
+        return Op::GREATER;
+    if (dynamic_cast<ir::GreaterEqualInstruction*>(inst))
+        return Op::GREATER_EQUAL;
+    if (dynamic_cast<ir::EqualInstruction*>(inst))
+        return Op::EQUAL;
+    if (dynamic_cast<ir::NotEqualInstruction*>(inst))
+        return Op::NOT_EQUAL;
+    return Op::LEAF;
+}
+
+void InstructionSelector::prepareFunction(ir::Function *func)
+{
+    useCount.clear();
+    for (ir::BasicBlock *bb : func->getBasicBlocks()){
+        for (ir::Instruction *inst : bb->getInstructions()){
+            for (ir::Value *operand : ir::getInstructionOperands(inst))
+                useCount[operand]++;
+        }
+    }
+}
+
+void InstructionSelector::prepareBlock(ir::BasicBlock *block)
+{
+    nodes.clear();
+    roots.clear();
+    folded.clear();
+
+    std::vector<ir::Instruction*> &instructions = block->getInstructions();
+    for (int i = static_cast<int>(instructions.size()) - 1; i >= 0; i--){
+        if (folded.count(instructions[i]) || getOp(instructions[i]) == Op::LEAF)
+            continue;
+
+        int pos = i;
+        Node *root = buildTree(instructions, pos);
+        label(root);
+        roots[instructions[i]] = root;
+    }
+}
+
+InstructionSelector::Node *InstructionSelector::buildTree(std::vector<ir::Instruction*> &instructions, int &pos)
+{
+    ir::Instruction *inst = instructions[pos];
+    nodes.push_back(Node());
+    Node *node = &nodes.back();
+    node->op = getOp(inst);
+    node->inst = inst;
+    ir::ResultInstruction *resultInst = dynamic_cast<ir::ResultInstruction*>(inst);
+    node->value = resultInst != nullptr ? resultInst->getResult() : nullptr;
+
+    // operands are evaluated left to right, so the right one is computed closer to its use
+    std::vector<ir::Value*> operands = ir::getInstructionOperands(inst);
+    node->kids.resize(operands.size());
+    for (int i = static_cast<int>(operands.size()) - 1; i >= 0; i--){
+        ir::Value *operand = operands[i];
+        ir::ResultInstruction *defInst = pos > 0 ? dynamic_cast<ir::ResultInstruction*>(instructions[pos - 1]) : nullptr;
+        if (defInst != nullptr && defInst->getResult() == operand && operand->getType() == ir::Value::Type::TEMPORARY
+                && useCount[operand] == 1 && getOp(instructions[pos - 1]) != Op::LEAF){
+            pos--;
+            folded.insert(instructions[pos]);
+            node->kids[i] = buildTree(instructions, pos);
+        } else
+            node->kids[i] = createLeaf(operand);
+    }
+
+    // constants go to the right, relational operators are mirrored
+    if (node->kids.size() == 2 && isConstantLeaf(node->kids[0]) && !isConstantLeaf(node->kids[1])){
+        switch (node->op){
+        case Op::SUB:
+            return node;
+        case Op::LESS:          node->op = Op::GREATER; break;
+        case Op::GREATER:       node->op = Op::LESS; break;
+        case Op::LESS_EQUAL:    node->op = Op::GREATER_EQUAL; break;
+        case Op::GREATER_EQUAL: node->op = Op::LESS_EQUAL; break;
+        default: break;
+        }
+        std::swap(node->kids[0], node->kids[1]);
+    }
+    return node;
+}
+
+bool InstructionSelector::isConstantLeaf(const Node *node)
+{
+    return node->op == Op::LEAF && node->value->getType() == ir::Value::Type::CONSTANT;
+}
+
+InstructionSelector::Node *InstructionSelector::createLeaf(ir::Value *value)
+{
+    nodes.push_back(Node());
+    Node *node = &nodes.back();
+    node->op = Op::LEAF;
+    node->inst = nullptr;
+    node->value = value;
+    return node;
+}
+
+void InstructionSelector::label(Node *node)
+{
+    for (int nt = 0; nt < NON_TERMINAL_COUNT; nt++){
+        node->cost[nt] = InfiniteCost;
+        node->rule[nt] = nullptr;
+    }
+
+    if (node->op == Op::LEAF){
+        // non-zero constant has to be loaded with li first
+        int imm;
+        node->cost[REG] = constantValue(node->value, imm) && imm != 0 ? 1 : 0;
+        return;
+    }
+
+    for (Node *kid : node->kids)
+        label(kid);
+
+    for (const Rule &rule : rules){
+        if (rule.pattern.op != node->op)
+            continue;
+
+        int cost = match(rule.pattern, node);
+        if (cost < InfiniteCost && cost + rule.cost < node->cost[rule.lhs]){
+            node->cost[rule.lhs] = cost + rule.cost;
+            node->rule[rule.lhs] = &rule;
+        }
+    }
+
+    // chain rules
+    for (const Rule &rule : rules){
+        if (rule.pattern.op != Op::LEAF)
+            continue;
+
+        NonTerminal from = rule.pattern.leaf == Leaf::BOOL ? BOOL : REG;
+        if (node->cost[from] + rule.cost < node->cost[rule.lhs]){
+            node->cost[rule.lhs] = node->cost[from] + rule.cost;
+            node->rule[rule.lhs] = &rule;
+        }
+    }
+}
+
+int InstructionSelector::match(const Pattern &pattern, Node *node) const
+{
+    if (pattern.op == Op::LEAF){
+        if (pattern.leaf == Leaf::REG)
+            return node->cost[REG];
+        if (pattern.leaf == Leaf::BOOL)
+            return node->cost[BOOL];
+
+        int imm;
+        if (node->op != Op::LEAF || !constantValue(node->value, imm))
+            return InfiniteCost;
+
+        bool fits = false;
+        switch (pattern.leaf){
+        case Leaf::ZERO:         fits = imm == 0; break;
+        case Leaf::IMM:          fits = fitsSigned16(imm); break;
+        case Leaf::UIMM:         fits = fitsUnsigned16(imm); break;
+        case Leaf::IMM_PLUS_ONE: fits = fitsSigned16(static_cast<int64_t>(imm) + 1); break;
+        case Leaf::NEG_IMM:      fits = fitsSigned16(-static_cast<int64_t>(imm)); break;
+        default: break;
+        }
+        return fits ? 0 : InfiniteCost;
+    }
+
+    if (pattern.op != node->op || pattern.kids.size() != node->kids.size())
+        return InfiniteCost;
+
+    int cost = 0;
+    for (size_t i = 0; i < pattern.kids.size(); i++){
+        cost += match(pattern.kids[i], node->kids[i]);
+        if (cost >= InfiniteCost)
+            return InfiniteCost;
+    }
+    return cost;
+}
+
+void InstructionSelector::collectLeaves(const Pattern &pattern, Node *node, std::vector<std::pair<Leaf, Node*>> &leaves) const
+{
+    if (pattern.op == Op::LEAF){
+        leaves.push_back(std::make_pair(pattern.leaf, node));
+        return;
+    }
+
+    for (size_t i = 0; i < pattern.kids.size(); i++)
+        collectLeaves(pattern.kids[i], node->kids[i], leaves);
+}
+
+bool InstructionSelector::select(ir::Instruction *inst, FunctionContext &function)
+{
+    if (folded.count(inst))
+        return true;
+
+    auto itr = roots.find(inst);
+    if (itr == roots.end())
+        return false;
+
+    reduce(itr->second, itr->second->op == Op::COND_JUMP ? STMT : REG, function);
+    return true;
+}
+
+const mips::Register *InstructionSelector::reduce(Node *node, NonTerminal nt, FunctionContext &function)
+{
+    BlockContext *block = function.Active();
+    if (node->op == Op::LEAF)
+        return block->getRegister(node->value);
+
+    const Rule *rule = node->rule[nt];
+    if (rule->pattern.op == Op::LEAF)
+        return reduce(node, rule->pattern.leaf == Leaf::BOOL ? BOOL : REG, function);
+
+    std::vector<std::pair<Leaf, Node*>> leaves;
+    collectLeaves(rule->pattern, node, leaves);
+
+    // subtrees first, then all operand registers at once as the visit methods do
+    for (auto &leaf : leaves){
+        if ((leaf.first == Leaf::REG || leaf.first == Leaf::BOOL) && leaf.second->op != Op::LEAF)
+            reduce(leaf.second, leaf.first == Leaf::BOOL ? BOOL : REG, function);
+    }
+
+    std::vector<const mips::Register*> regs(leaves.size(), nullptr);
+    for (size_t i = 0; i < leaves.size(); i++){
+        if (leaves[i].first == Leaf::REG || leaves[i].first == Leaf::BOOL)
+            regs[i] = block->getRegister(leaves[i].second->value);
+    }
+
+    const mips::Register *destReg = nullptr;
+    if (rule->lhs != STMT){
+        destReg = block->getRegister(node->value, false);
+        block->markChanged(destReg);
+    }
+    for (size_t i = 0; i < leaves.size(); i++){
+        if (regs[i] != nullptr)
+            block->markUsed(leaves[i].second->value);
+    }
+    if (rule->lhs == STMT)
+        block->saveUnsavedVariables();
+
+    for (const Template &line : rule->code){
+        std::vector<mips::Operand> operands;
+
+        for (const std::string &token : line.operands){
+            if (token == "%d"){
+                operands.push_back(mips::Operand::reg(*destReg));
+            } else if (token == "%s"){
+                operands.push_back(mips::Operand::reg(*function.getMips()->getRetRegister()));
+            } else if (token == "$0"){
+                operands.push_back(mips::Operand::reg(*function.getMips()->getZero()));
+            } else if (token == "%T" || token == "%F"){
+                ir::CondJumpInstruction *jump = static_cast<ir::CondJumpInstruction*>(node->inst);
+                ir::BasicBlock *target = token == "%T" ? jump->getTrueBasicBlock() : jump->getFalseBasicBlock();
+                operands.push_back(mips::Operand::label(function.getBlockContext(target)->getName()));
+            } else if (token[0] == '%'){
+                operands.push_back(mips::Operand::reg(*regs[token[1] - 'a']));
+            } else if (token[0] == '#'){
+                int imm = 0;
+                bool negate = token[1] == '-';
+                constantValue(leaves[token[negate ? 2 : 1] - 'a'].second->value, imm);
+                int64_t value = negate ? -static_cast<int64_t>(imm) : imm;
+                if (token.find("+1") != std::string::npos)
+                    value += 1;
+                operands.push_back(mips::Operand::imm(static_cast<int>(value)));
+            } else
+                operands.push_back(mips::Operand::imm(std::stoi(token)));
+        }
+        block->addInstruction(mips::MachineInstruction(line.opcode, operands));
+    }
+    return destReg;
+}
+
+} // namespace backend
@@ -0,0 +1,104 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#ifndef INSTRUCTIONSELECTOR_H
+#define INSTRUCTIONSELECTOR_H
+
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "ir/value.h"
+#include "ir/instruction.h"
+#include "ir/basic_block.h"
+#include "ir/function.h"
+#include "backend/functioncontext.h"
+#include "backend/mips.h"
+#include "backend/machineinstruction.h"
+
+
+namespace backend{
+
+/**
+ * Tree-pattern instruction selector for int arithmetic, comparisons and conditional jumps.
+ *
+ * Temporary used only once, which is computed right before the instruction using it,
+ * is folded into the expression tree of that instruction. Trees are labeled bottom-up
+ * with the cheapest rule for every nonterminal and the chosen cover is emitted top-down.
+ * Rules pair a pattern over IR operations with a MIPS code template, see rule table
+ * in instructionselector.cpp.
+ */
+class InstructionSelector
+{
+public:
+    InstructionSelector();
+    ~InstructionSelector();
+
+    void prepareFunction(ir::Function *func);
+    void prepareBlock(ir::BasicBlock *block);
+
+    // emits tree rooted at the instruction, instructions folded into a tree emit nothing;
+    // false means the instruction is not handled by the selector
+    bool select(ir::Instruction *inst, FunctionContext &function);
+
+private:
+    enum class Op { LEAF, ADD, SUB, AND, OR, XOR, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL,
+                    EQUAL, NOT_EQUAL, LOGICAL_AND, LOGICAL_OR, NOT, COND_JUMP };
+    enum NonTerminal { REG, BOOL, STMT, NON_TERMINAL_COUNT };
+    // pattern leaves are either nonterminals or constants fitting into the immediate field
+    enum class Leaf { NONE, REG, BOOL, ZERO, IMM, UIMM, IMM_PLUS_ONE, NEG_IMM };
+
+    struct Pattern{
+        Op op;
+        Leaf leaf;
+        std::vector<Pattern> kids;
+    };
+
+    // instruction of a code template, operands are kept as template tokens
+    struct Template{
+        mips::Opcode opcode;
+        std::vector<std::string> operands;
+    };
+
+    struct Rule{
+        NonTerminal lhs;
+        Pattern pattern;
+        int cost;
+        std::vector<Template> code;
+    };
+
+    struct Node{
+        Op op;
+        ir::Instruction *inst;
+        ir::Value *value;
+        std::vector<Node*> kids;
+        int cost[NON_TERMINAL_COUNT];
+        const Rule *rule[NON_TERMINAL_COUNT];
+    };
+
+    std::vector<Rule> rules;
+    std::map<ir::Value*, int> useCount;
+    std::deque<Node> nodes;
+    std::map<ir::Instruction*, Node*> roots;
+    std::set<ir::Instruction*> folded;
+
+    static Op getOp(ir::Instruction *inst);
+    static Pattern parsePattern(const std::string &text, size_t &pos);
+    static Template parseTemplate(const std::string &line);
+    static bool isConstantLeaf(const Node *node);
+
+    Node *buildTree(std::vector<ir::Instruction*> &instructions, int &pos);
+    Node *createLeaf(ir::Value *value);
+    void label(Node *node);
+    int match(const Pattern &pattern, Node *node) const;
+    void collectLeaves(const Pattern &pattern, Node *node, std::vector<std::pair<Leaf, Node*>> &leaves) const;
+    const mips::Register *reduce(Node *node, NonTerminal nt, FunctionContext &function);
+};
+
+} // namespace backend
+
+#endif // INSTRUCTIONSELECTOR_H
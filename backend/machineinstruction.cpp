@@ -0,0 +1,251 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#include <algorithm>
+#include <cctype>
+
+#include "machineinstruction.h"
+
+
+namespace mips{
+
+bool findOpcode(const std::string &name, Opcode &opcode)
+{
+    std::string lower = name;
+    std::transform(lower.begin(), lower.end(), lower.begin(), ::tolower);
+
+    for (unsigned i = 0; i < static_cast<unsigned>(Opcode::OPCODE_COUNT); i++){
+        if (opcodeTable[i].format != Format::NONE && lower == opcodeTable[i].name){
+            opcode = static_cast<Opcode>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+
+Operand::Operand(Kind kind, const Register *reg, int imm, const std::string &label):
+    kind(kind), reg_(reg), imm_(imm), label_(label)
+{
+}
+
+Operand Operand::reg(const Register &reg)
+{
+    return Operand(Kind::REGISTER, &reg, 0, "");
+}
+
+Operand Operand::imm(int imm)
+{
+    return Operand(Kind::IMMEDIATE, nullptr, imm, "");
+}
+
+Operand Operand::label(const std::string &label)
+{
+    return Operand(Kind::LABEL, nullptr, 0, label);
+}
+
+Operand Operand::mem(int offset, const Register &base)
+{
+    return Operand(Kind::MEMORY, &base, offset, "");
+}
+
+const std::string Operand::toString() const
+{
+    switch (kind){
+    case Kind::REGISTER:
+        return reg_->getAsmName();
+    case Kind::IMMEDIATE:
+        return std::to_string(imm_);
+    case Kind::LABEL:
+        return label_;
+    case Kind::MEMORY:
+        return std::to_string(imm_) + "(" + reg_->getAsmName() + ")";
+    }
+    return "";
+}
+
+
+MachineInstruction::MachineInstruction(Opcode opcode, const std::vector<Operand> &operands):
+    opcode(opcode), operands(operands)
+{
+}
+
+MachineInstruction MachineInstruction::label(const std::string &name)
+{
+    MachineInstruction inst(Opcode::LABEL);
+    inst.text = name;
+    return inst;
+}
+
+MachineInstruction MachineInstruction::comment(const std::string &text)
+{
+    MachineInstruction inst(Opcode::COMMENT);
+    inst.text = text;
+    return inst;
+}
+
+bool MachineInstruction::isConditionalBranch() const
+{
+    switch (opcode){
+    case Opcode::BEQ: case Opcode::BNE: case Opcode::BLTZ: case Opcode::BGEZ:
+    case Opcode::BLEZ: case Opcode::BGTZ:
+        return true;
+    default:
+        return false;
+    }
+}
+
+bool MachineInstruction::isUnconditionalJump() const
+{
+    return opcode == Opcode::B || opcode == Opcode::J || opcode == Opcode::JR || opcode == Opcode::BREAK;
+}
+
+const Register *MachineInstruction::getDef() const
+{
+    switch (opcode){
+    case Opcode::SW: case Opcode::SB: case Opcode::MULT: case Opcode::JR: case Opcode::BREAK:
+    case Opcode::NOP: case Opcode::PRINT_CHAR: case Opcode::PRINT_INT: case Opcode::PRINT_STRING:
+    case Opcode::LABEL: case Opcode::COMMENT:
+        return nullptr;
+    case Opcode::DIV:
+        // two operand form writes only hi and lo
+        return operands.size() == 3 ? operands[0].getRegister() : nullptr;
+    case Opcode::READ_STRING:
+        // buffer address is read, length of the string is written
+        return operands[1].getRegister();
+    default:
+        break;
+    }
+    if (isConditionalBranch() || getInfo().format == Format::J || opcode == Opcode::B)
+        return nullptr;
+    if (operands.empty() || operands[0].getKind() != Operand::Kind::REGISTER)
+        return nullptr;
+    return operands[0].getRegister();
+}
+
+RegisterSet MachineInstruction::getDefs() const
+{
+    RegisterSet regs;
+    if (getDef() != nullptr)
+        regs.set(getDef()->getID());
+    if (opcode == Opcode::MULT || opcode == Opcode::DIV || opcode == Opcode::MUL){
+        // mul leaves hi and lo unpredictable
+        regs.set(HiRegister);
+        regs.set(LoRegister);
+    }
+    // writes to $zero are lost, it does not carry any value between instructions
+    regs.reset(0);
+    return regs;
+}
+
+RegisterSet MachineInstruction::getUses() const
+{
+    RegisterSet regs;
+    const Register *def = getDef();
+    for (size_t i = 0; i < operands.size(); i++){
+        const Operand &op = operands[i];
+        if (op.getKind() == Operand::Kind::MEMORY)
+            regs.set(op.getRegister()->getID());
+        else if (op.getKind() == Operand::Kind::REGISTER && !(def == op.getRegister() && i == (opcode == Opcode::READ_STRING ? 1u : 0u)))
+            regs.set(op.getRegister()->getID());
+    }
+    if (opcode == Opcode::MFHI)
+        regs.set(HiRegister);
+    else if (opcode == Opcode::MFLO)
+        regs.set(LoRegister);
+    return regs;
+}
+
+bool MachineInstruction::readsMemory() const
+{
+    return opcode == Opcode::LW || opcode == Opcode::LB || opcode == Opcode::LBU || opcode == Opcode::PRINT_STRING;
+}
+
+bool MachineInstruction::writesMemory() const
+{
+    return opcode == Opcode::SW || opcode == Opcode::SB || opcode == Opcode::READ_STRING;
+}
+
+bool MachineInstruction::conflictsWith(const MachineInstruction &other) const
+{
+    RegisterSet defs = getDefs(), otherDefs = other.getDefs();
+    if ((defs & (other.getUses() | otherDefs)).any() || (otherDefs & getUses()).any())
+        return true;
+    if (hasSideEffect() && other.hasSideEffect())
+        return true;
+    if (!(writesMemory() && (other.readsMemory() || other.writesMemory())) && !(readsMemory() && other.writesMemory()))
+        return false;
+
+    // accesses relative to the same base register do not overlap if their offsets differ
+    // enough, a change of the base between them orders them through the register anyway
+    const Operand *mem = getMemoryOperand(), *otherMem = other.getMemoryOperand();
+    if (mem == nullptr || otherMem == nullptr || mem->getRegister() != otherMem->getRegister())
+        return true;
+    return mem->getImmediate() < otherMem->getImmediate() + other.getAccessSize()
+            && otherMem->getImmediate() < mem->getImmediate() + getAccessSize();
+}
+
+const Operand *MachineInstruction::getMemoryOperand() const
+{
+    for (auto &op : operands){
+        if (op.getKind() == Operand::Kind::MEMORY)
+            return &op;
+    }
+    return nullptr;
+}
+
+int MachineInstruction::getAccessSize() const
+{
+    return (opcode == Opcode::LW || opcode == Opcode::SW) ? 4 : 1;
+}
+
+const std::string MachineInstruction::getTarget() const
+{
+    if (!isConditionalBranch() && opcode != Opcode::B && opcode != Opcode::J && opcode != Opcode::JAL)
+        return "";
+    return operands.back().getLabel();
+}
+
+unsigned MachineInstruction::getSize() const
+{
+    if (opcode == Opcode::LI && !operands.empty()){
+        // assembler expands li into lui + ori only for immediates not fitting 16 bits
+        int imm = operands.back().getImmediate();
+        if (imm >= -32768 && imm <= 65535)
+            return 4;
+    } else if (opcode == Opcode::DIV && operands.size() == 3){
+        // div with destination register is div + mflo
+        return 8;
+    }
+    return getInfo().size;
+}
+
+const std::string MachineInstruction::toString() const
+{
+    if (isLabel())
+        return text + ":";
+    if (isComment())
+        return Indent + text;
+
+    std::string line = Indent + getInfo().name;
+    for (auto it = operands.begin(); it != operands.end(); ++it){
+        line += (it == operands.begin()) ? " " : ", ";
+        line += it->toString();
+    }
+    return line;
+}
+
+
+unsigned printCode(const std::vector<MachineInstruction> &code, std::string &out)
+{
+    unsigned size = 0;
+    for (auto &inst : code){
+        out += inst.toString() + "\n";
+        size += inst.getSize();
+    }
+    return size;
+}
+
+} // namespace mips
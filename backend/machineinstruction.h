@@ -0,0 +1,199 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#ifndef MACHINEINSTRUCTION_H
+#define MACHINEINSTRUCTION_H
+
+#include <bitset>
+#include <string>
+#include <vector>
+
+#include "backend/mips.h"
+
+
+namespace mips{
+
+enum class Opcode {
+    ADD, ADDI, ADDIU, ADDU, AND, ANDI, B, BEQ, BGEZ, BGTZ, BLEZ, BLTZ, BNE, BREAK, DIV,
+    J, JAL, JR, LA, LB, LBU, LI, LUI, LW, MFHI, MFLO, MOVE, MUL, MULT, NOP, NOR, OR, ORI,
+    PRINT_CHAR, PRINT_INT, PRINT_STRING, READ_CHAR, READ_INT, READ_STRING,
+    SB, SLL, SLLV, SLT, SLTI, SLTIU, SLTU, SRA, SRAV, SRL, SUB, SUBU, SW, XOR, XORI,
+    LABEL, COMMENT,
+    OPCODE_COUNT
+};
+
+// R, I and J are MIPS32 encodings, REGIMM branches keep the condition in rt field,
+// SERVICE are I/O instructions of the simulator, PSEUDO are expanded by the assembler
+enum class Format { R, I, J, REGIMM, SPECIAL2, SERVICE, PSEUDO, NONE };
+
+struct OpcodeInfo{
+    const char *name;
+    Format format;
+    unsigned opcode;   // primary opcode field
+    unsigned funct;    // function field of R-type, rt field of REGIMM
+    unsigned size;     // size in bytes, li with short immediate is only one word
+};
+
+constexpr OpcodeInfo opcodeTable[] = {
+    { "add",          Format::R,        0x00, 0x20, 4 },
+    { "addi",         Format::I,        0x08, 0x00, 4 },
+    { "addiu",        Format::I,        0x09, 0x00, 4 },
+    { "addu",         Format::R,        0x00, 0x21, 4 },
+    { "and",          Format::R,        0x00, 0x24, 4 },
+    { "andi",         Format::I,        0x0c, 0x00, 4 },
+    { "b",            Format::PSEUDO,   0x04, 0x00, 4 },
+    { "beq",          Format::I,        0x04, 0x00, 4 },
+    { "bgez",         Format::REGIMM,   0x01, 0x01, 4 },
+    { "bgtz",         Format::I,        0x07, 0x00, 4 },
+    { "blez",         Format::I,        0x06, 0x00, 4 },
+    { "bltz",         Format::REGIMM,   0x01, 0x00, 4 },
+    { "bne",          Format::I,        0x05, 0x00, 4 },
+    { "break",        Format::R,        0x00, 0x0d, 4 },
+    { "div",          Format::R,        0x00, 0x1a, 4 },
+    { "j",            Format::J,        0x02, 0x00, 4 },
+    { "jal",          Format::J,        0x03, 0x00, 4 },
+    { "jr",           Format::R,        0x00, 0x08, 4 },
+    { "la",           Format::PSEUDO,   0x00, 0x00, 8 },
+    { "lb",           Format::I,        0x20, 0x00, 4 },
+    { "lbu",          Format::I,        0x24, 0x00, 4 },
+    { "li",           Format::PSEUDO,   0x00, 0x00, 8 },
+    { "lui",          Format::I,        0x0f, 0x00, 4 },
+    { "lw",           Format::I,        0x23, 0x00, 4 },
+    { "mfhi",         Format::R,        0x00, 0x10, 4 },
+    { "mflo",         Format::R,        0x00, 0x12, 4 },
+    { "move",         Format::PSEUDO,   0x00, 0x21, 4 },
+    { "mul",          Format::SPECIAL2, 0x1c, 0x02, 4 },
+    { "mult",         Format::R,        0x00, 0x18, 4 },
+    { "nop",          Format::R,        0x00, 0x00, 4 },
+    { "nor",          Format::R,        0x00, 0x27, 4 },
+    { "or",           Format::R,        0x00, 0x25, 4 },
+    { "ori",          Format::I,        0x0d, 0x00, 4 },
+    { "print_char",   Format::SERVICE,  0x00, 0x00, 4 },
+    { "print_int",    Format::SERVICE,  0x00, 0x00, 4 },
+    { "print_string", Format::SERVICE,  0x00, 0x00, 4 },
+    { "read_char",    Format::SERVICE,  0x00, 0x00, 4 },
+    { "read_int",     Format::SERVICE,  0x00, 0x00, 4 },
+    { "read_string",  Format::SERVICE,  0x00, 0x00, 4 },
+    { "sb",           Format::I,        0x28, 0x00, 4 },
+    { "sll",          Format::R,        0x00, 0x00, 4 },
+    { "sllv",         Format::R,        0x00, 0x04, 4 },
+    { "slt",          Format::R,        0x00, 0x2a, 4 },
+    { "slti",         Format::I,        0x0a, 0x00, 4 },
+    { "sltiu",        Format::I,        0x0b, 0x00, 4 },
+    { "sltu",         Format::R,        0x00, 0x2b, 4 },
+    { "sra",          Format::R,        0x00, 0x03, 4 },
+    { "srav",         Format::R,        0x00, 0x07, 4 },
+    { "srl",          Format::R,        0x00, 0x02, 4 },
+    { "sub",          Format::R,        0x00, 0x22, 4 },
+    { "subu",         Format::R,        0x00, 0x23, 4 },
+    { "sw",           Format::I,        0x2b, 0x00, 4 },
+    { "xor",          Format::R,        0x00, 0x26, 4 },
+    { "xori",         Format::I,        0x0e, 0x00, 4 },
+    { "",             Format::NONE,     0x00, 0x00, 0 },
+    { "",             Format::NONE,     0x00, 0x00, 0 },
+};
+
+static_assert(sizeof(opcodeTable) / sizeof(opcodeTable[0]) == static_cast<unsigned>(Opcode::OPCODE_COUNT),
+              "every opcode needs its entry in opcodeTable");
+
+constexpr const OpcodeInfo &getOpcodeInfo(Opcode opcode)
+{
+    return opcodeTable[static_cast<unsigned>(opcode)];
+}
+
+// numbers of hi and lo registers in def and use sets, they follow the general purpose ones
+constexpr unsigned HiRegister = 32;
+constexpr unsigned LoRegister = 33;
+typedef std::bitset<LoRegister + 1> RegisterSet;
+
+// finds opcode by its mnemonic, case insensitive
+bool findOpcode(const std::string &name, Opcode &opcode);
+
+
+class Operand{
+public:
+    enum class Kind { REGISTER, IMMEDIATE, LABEL, MEMORY };
+
+    static Operand reg(const Register &reg);
+    static Operand imm(int imm);
+    static Operand label(const std::string &label);
+    static Operand mem(int offset, const Register &base);
+
+    Kind getKind() const            {return kind;}
+    const Register *getRegister() const {return reg_;}
+    int getImmediate() const        {return imm_;}
+    const std::string &getLabel() const {return label_;}
+
+    const std::string toString() const;
+
+private:
+    Operand(Kind kind, const Register *reg, int imm, const std::string &label);
+
+    Kind kind;
+    const Register *reg_;   // register, base of memory operand
+    int imm_;               // immediate, offset of memory operand
+    std::string label_;
+};
+
+
+/**
+ * Single instruction of generated code. Labels and comments are kept in the same
+ * sequence so the code can be analysed and rewritten before it is printed.
+ */
+class MachineInstruction{
+public:
+    MachineInstruction(Opcode opcode, const std::vector<Operand> &operands = std::vector<Operand>());
+
+    static MachineInstruction label(const std::string &name);
+    static MachineInstruction comment(const std::string &text);
+
+    Opcode getOpcode() const        {return opcode;}
+    void setOpcode(Opcode opcode)   {this->opcode = opcode;}
+    const OpcodeInfo &getInfo() const {return getOpcodeInfo(opcode);}
+    std::vector<Operand> &getOperands() {return operands;}
+    const std::vector<Operand> &getOperands() const {return operands;}
+    const std::string &getText() const {return text;}
+
+    bool isLabel() const            {return opcode == Opcode::LABEL;}
+    bool isComment() const          {return opcode == Opcode::COMMENT;}
+    bool isCall() const             {return opcode == Opcode::JAL;}
+    bool isConditionalBranch() const;
+    // control never falls through to the next instruction
+    bool isUnconditionalJump() const;
+
+    // register written by the instruction, nullptr if there is none; calls are not covered
+    const Register *getDef() const;
+    // all registers written and read, including hi and lo, $zero is never written; calls are not covered
+    RegisterSet getDefs() const;
+    RegisterSet getUses() const;
+    bool readsMemory() const;
+    bool writesMemory() const;
+    // simulator I/O, has to keep its order
+    bool hasSideEffect() const      {return getInfo().format == Format::SERVICE;}
+    // order of the two instructions matters, one reads or writes a register the other writes,
+    // both may access the same memory and one of them writes it, or both do I/O
+    bool conflictsWith(const MachineInstruction &other) const;
+    // label the instruction jumps to, empty if it is not a jump
+    const std::string getTarget() const;
+
+    unsigned getSize() const;
+    const std::string toString() const;
+
+private:
+    Opcode opcode;
+    std::vector<Operand> operands;
+    std::string text;   // name of label, text of comment
+
+    const Operand *getMemoryOperand() const;
+    // bytes accessed by load or store
+    int getAccessSize() const;
+};
+
+// assembly printer, returns size of the printed code in bytes
+unsigned printCode(const std::vector<MachineInstruction> &code, std::string &out);
+
+} // namespace mips
+
+#endif // MACHINEINSTRUCTION_H
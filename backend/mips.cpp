@@ -4,6 +4,7 @@
  **/
 
 #include "mips.h"
+#include "machineinstruction.h"
 
 
 namespace mips {
@@ -113,31 +114,32 @@ const Register *MIPS::getRetRegister() const
     return &R2;
 }
 
+const Register *MIPS::getSecondRetRegister() const
+{
+    return &R3;
+}
+
 const Register *MIPS::getZero() const
 {
     return &R0;
 }
 
-const std::string MIPS::getFunctionPrologue() const
+void MIPS::getFunctionPrologue(std::vector<MachineInstruction> &code) const
 {
-    std::string prologue = "  addi $sp, $sp, -8 \n";
-    prologue +=            "  sw $ra, 4($sp)  \n";
-    prologue +=            "  sw $fp, 0($sp)  \n";
-    prologue +=            "  move $fp, $sp  \n";
-
-    return prologue;
+    code.emplace_back(Opcode::ADDI, std::vector<Operand>{Operand::reg(R29), Operand::reg(R29), Operand::imm(-8)});
+    code.emplace_back(Opcode::SW, std::vector<Operand>{Operand::reg(R31), Operand::mem(4, R29)});
+    code.emplace_back(Opcode::SW, std::vector<Operand>{Operand::reg(R30), Operand::mem(0, R29)});
+    code.emplace_back(Opcode::MOVE, std::vector<Operand>{Operand::reg(R30), Operand::reg(R29)});
 }
 
 
-const std::string MIPS::getFunctionEpilogue() const
+void MIPS::getFunctionEpilogue(std::vector<MachineInstruction> &code) const
 {
-    std::string prologue = "  lw $ra, 4($fp)  \n";
-    prologue +=            "  move $sp, $fp  \n";
-    prologue +=            "  lw $fp, 0($fp)  \n";
-    prologue +=            "  addi $sp, $sp, 8 \n";
-    prologue +=            "  jr $ra          \n";
-
-    return prologue;
+    code.emplace_back(Opcode::LW, std::vector<Operand>{Operand::reg(R31), Operand::mem(4, R30)});
+    code.emplace_back(Opcode::MOVE, std::vector<Operand>{Operand::reg(R29), Operand::reg(R30)});
+    code.emplace_back(Opcode::LW, std::vector<Operand>{Operand::reg(R30), Operand::mem(0, R30)});
+    code.emplace_back(Opcode::ADDI, std::vector<Operand>{Operand::reg(R29), Operand::reg(R29), Operand::imm(8)});
+    code.emplace_back(Opcode::JR, std::vector<Operand>{Operand::reg(R31)});
 }
 
 
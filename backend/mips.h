@@ -16,6 +16,8 @@
 namespace mips{
 extern const std::string Indent;
 
+class MachineInstruction;
+
 
 
 
@@ -44,13 +46,14 @@ public:
     const Register& getRAPointer() const;
     const std::vector<const Register *>& getParamRegisters() const;
 
-    const std::string getFunctionPrologue() const;
-    const std::string getFunctionEpilogue() const;
+    void getFunctionPrologue(std::vector<MachineInstruction> &code) const;
+    void getFunctionEpilogue(std::vector<MachineInstruction> &code) const;
 
     const std::vector<const Register *> &getEvalRegisters() const;
     const std::vector<const Register *> &getCalleeSavedRegisters() const;
     const std::vector<const Register *> &getCallerSavedRegisters() const;
     const Register *getRetRegister() const;
+    const Register *getSecondRetRegister() const;
     const Register *getZero() const;
 
 private:
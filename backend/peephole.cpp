@@ -0,0 +1,271 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#include <map>
+
+#include "peephole.h"
+
+
+namespace backend{
+
+namespace {
+
+const char *ruleNames[] = { "no effect", "load of stored value", "known constant",
+                            "jump to next label", "branch over jump", "unreachable" };
+
+// MOVE r, r and adding zero to itself
+bool hasNoEffect(const mips::MachineInstruction &inst)
+{
+    const std::vector<mips::Operand> &op = inst.getOperands();
+    switch (inst.getOpcode()){
+    case mips::Opcode::MOVE:
+        return op[0].getRegister() == op[1].getRegister();
+    case mips::Opcode::ADDI: case mips::Opcode::ADDIU: case mips::Opcode::ORI:
+        return op[0].getRegister() == op[1].getRegister() && op[2].getImmediate() == 0;
+    case mips::Opcode::ADD: case mips::Opcode::ADDU: case mips::Opcode::OR:
+        return op[0].getRegister() == op[1].getRegister() && op[2].getRegister()->getID() == 0;
+    default:
+        return false;
+    }
+}
+
+bool sameMemory(const mips::Operand &a, const mips::Operand &b)
+{
+    return a.getKind() == mips::Operand::Kind::MEMORY && b.getKind() == mips::Operand::Kind::MEMORY
+            && a.getRegister() == b.getRegister() && a.getImmediate() == b.getImmediate();
+}
+
+} // anonymous namespace
+
+Peephole::Peephole()
+{
+
+}
+
+void Peephole::run(std::vector<mips::MachineInstruction> &code)
+{
+    bool changed;
+    do{
+        targets.clear();
+        for (auto &inst : code){
+            if (!inst.getTarget().empty())
+                targets.insert(inst.getTarget());
+        }
+
+        changed = noEffect(code);
+        changed |= storeLoad(code);
+        changed |= knownConstant(code);
+        changed |= jumpToNext(code);
+        changed |= branchOverJump(code);
+        changed |= unreachable(code);
+    } while (changed);
+}
+
+const std::string Peephole::getStatistics() const
+{
+    std::string text;
+    for (int rule = 0; rule < RULE_COUNT; rule++){
+        text += "#Peephole " + std::string(ruleNames[rule]) + ": removed " + std::to_string(stats[rule].removed)
+                + ", rewritten " + std::to_string(stats[rule].rewritten) + "\n";
+    }
+    return text;
+}
+
+bool Peephole::isBarrier(const mips::MachineInstruction &inst) const
+{
+    // labels no jump refers to are only entered from the previous instruction
+    return inst.isLabel() && targets.count(inst.getText());
+}
+
+size_t Peephole::next(const std::vector<mips::MachineInstruction> &code, size_t pos) const
+{
+    pos++;
+    while (pos < code.size() && (code[pos].isComment() || (code[pos].isLabel() && !isBarrier(code[pos]))))
+        pos++;
+    return pos;
+}
+
+bool Peephole::isLabelAhead(const std::vector<mips::MachineInstruction> &code, size_t pos, const std::string &label) const
+{
+    // label is reached without executing anything if it is in the run of labels following pos
+    for (pos = next(code, pos); pos < code.size() && code[pos].isLabel(); pos = next(code, pos)){
+        if (code[pos].getText() == label)
+            return true;
+    }
+    return false;
+}
+
+bool Peephole::invertBranch(mips::MachineInstruction &inst)
+{
+    static const std::map<mips::Opcode, mips::Opcode> inverse = {
+        { mips::Opcode::BEQ, mips::Opcode::BNE }, { mips::Opcode::BNE, mips::Opcode::BEQ },
+        { mips::Opcode::BLTZ, mips::Opcode::BGEZ }, { mips::Opcode::BGEZ, mips::Opcode::BLTZ },
+        { mips::Opcode::BLEZ, mips::Opcode::BGTZ }, { mips::Opcode::BGTZ, mips::Opcode::BLEZ }
+    };
+
+    auto itr = inverse.find(inst.getOpcode());
+    if (itr == inverse.end())
+        return false;
+    inst.setOpcode(itr->second);
+    return true;
+}
+
+void Peephole::remove(std::vector<mips::MachineInstruction> &code, size_t pos, Rule rule)
+{
+    stats[rule].removed += code[pos].getSize() / 4;
+    code.erase(code.begin() + pos);
+}
+
+void Peephole::rewrite(mips::MachineInstruction &inst, const mips::MachineInstruction &with, Rule rule)
+{
+    stats[rule].removed += (inst.getSize() - with.getSize()) / 4;
+    stats[rule].rewritten++;
+    inst = with;
+}
+
+bool Peephole::noEffect(std::vector<mips::MachineInstruction> &code)
+{
+    bool changed = false;
+    for (size_t i = 0; i < code.size(); ){
+        if (hasNoEffect(code[i])){
+            remove(code, i, NO_EFFECT);
+            changed = true;
+        } else
+            i++;
+    }
+    return changed;
+}
+
+// SW r, x(b); LW s, x(b) -> SW r, x(b); MOVE s, r
+bool Peephole::storeLoad(std::vector<mips::MachineInstruction> &code)
+{
+    bool changed = false;
+    for (size_t i = 0; i < code.size(); i++){
+        if (code[i].getOpcode() != mips::Opcode::SW)
+            continue;
+
+        size_t j = next(code, i);
+        if (j == code.size() || code[j].getOpcode() != mips::Opcode::LW
+                || !sameMemory(code[i].getOperands()[1], code[j].getOperands()[1]))
+            continue;
+
+        const mips::Register *stored = code[i].getOperands()[0].getRegister();
+        const mips::Register *loaded = code[j].getOperands()[0].getRegister();
+        if (stored == loaded)
+            remove(code, j, STORE_LOAD);
+        else
+            rewrite(code[j], mips::MachineInstruction(mips::Opcode::MOVE, {mips::Operand::reg(*loaded), mips::Operand::reg(*stored)}), STORE_LOAD);
+        changed = true;
+    }
+    return changed;
+}
+
+// LI of a constant the register already holds is removed, long constant held
+// by another register is copied from it instead of being built again
+bool Peephole::knownConstant(std::vector<mips::MachineInstruction> &code)
+{
+    bool changed = false;
+    std::map<const mips::Register*, int> known;
+
+    for (size_t i = 0; i < code.size(); ){
+        mips::MachineInstruction &inst = code[i];
+
+        if (isBarrier(inst) || inst.isCall() || inst.isUnconditionalJump()){
+            known.clear();
+        } else if (inst.getOpcode() == mips::Opcode::LI){
+            const mips::Register *reg = inst.getOperands()[0].getRegister();
+            int imm = inst.getOperands()[1].getImmediate();
+
+            auto itr = known.find(reg);
+            if (itr != known.end() && itr->second == imm){
+                remove(code, i, KNOWN_CONSTANT);
+                changed = true;
+                continue;
+            }
+            if (inst.getSize() > 4){
+                for (auto &it : known){
+                    if (it.second == imm){
+                        rewrite(inst, mips::MachineInstruction(mips::Opcode::MOVE, {mips::Operand::reg(*reg), mips::Operand::reg(*it.first)}), KNOWN_CONSTANT);
+                        changed = true;
+                        break;
+                    }
+                }
+            }
+            known[reg] = imm;
+        } else if (inst.getOpcode() == mips::Opcode::MOVE){
+            const mips::Register *dst = inst.getOperands()[0].getRegister();
+            const mips::Register *src = inst.getOperands()[1].getRegister();
+            auto itr = known.find(src);
+            if (src->getID() == 0)
+                known[dst] = 0;
+            else if (itr != known.end())
+                known[dst] = itr->second;
+            else
+                known.erase(dst);
+        } else if (inst.getDef() != nullptr){
+            known.erase(inst.getDef());
+        }
+        i++;
+    }
+    return changed;
+}
+
+// J, B or branch to the label right behind it
+bool Peephole::jumpToNext(std::vector<mips::MachineInstruction> &code)
+{
+    bool changed = false;
+    for (size_t i = 0; i < code.size(); ){
+        const std::string target = code[i].getTarget();
+        if (!target.empty() && !code[i].isCall() && isLabelAhead(code, i, target)){
+            remove(code, i, JUMP_TO_NEXT);
+            changed = true;
+        } else
+            i++;
+    }
+    return changed;
+}
+
+// BNE x, y, L1; B L2; L1: -> BEQ x, y, L2; L1:
+bool Peephole::branchOverJump(std::vector<mips::MachineInstruction> &code)
+{
+    bool changed = false;
+    for (size_t i = 0; i < code.size(); i++){
+        if (!code[i].isConditionalBranch())
+            continue;
+
+        size_t j = next(code, i);
+        if (j == code.size() || (code[j].getOpcode() != mips::Opcode::B && code[j].getOpcode() != mips::Opcode::J))
+            continue;
+        if (!isLabelAhead(code, j, code[i].getTarget()) || !invertBranch(code[i]))
+            continue;
+
+        code[i].getOperands().back() = code[j].getOperands().back();
+        remove(code, j, BRANCH_OVER_JUMP);
+        changed = true;
+    }
+    return changed;
+}
+
+// code behind J, B or JR is dead until a label some jump refers to
+bool Peephole::unreachable(std::vector<mips::MachineInstruction> &code)
+{
+    bool changed = false;
+    for (size_t i = 0; i < code.size(); i++){
+        if (!code[i].isUnconditionalJump())
+            continue;
+
+        for (size_t j = i + 1; j < code.size() && !isBarrier(code[j]); ){
+            if (code[j].isComment() || code[j].isLabel())
+                j++;
+            else{
+                remove(code, j, UNREACHABLE);
+                changed = true;
+            }
+        }
+    }
+    return changed;
+}
+
+} // namespace backend
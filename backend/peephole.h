@@ -0,0 +1,65 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#ifndef PEEPHOLE_H
+#define PEEPHOLE_H
+
+#include <set>
+#include <string>
+#include <vector>
+
+#include "backend/machineinstruction.h"
+
+
+namespace backend{
+
+/**
+ * Peephole optimizer run over the machine code of a function after register allocation.
+ *
+ * Every rule looks at a small window of instructions (comments are skipped, labels some
+ * jump refers to end the window) and removes or rewrites redundant ones. Rules are
+ * repeated until none of them applies. Statistics are collected over all functions.
+ */
+class Peephole
+{
+public:
+    enum Rule { NO_EFFECT, STORE_LOAD, KNOWN_CONSTANT, JUMP_TO_NEXT, BRANCH_OVER_JUMP, UNREACHABLE, RULE_COUNT };
+
+    Peephole();
+
+    void run(std::vector<mips::MachineInstruction> &code);
+
+    // assembly comments with number of removed and rewritten instructions per rule
+    const std::string getStatistics() const;
+
+private:
+    struct Statistics{
+        unsigned removed = 0;   // machine words, li of long constant counts for two
+        unsigned rewritten = 0;
+    };
+
+    Statistics stats[RULE_COUNT];
+    std::set<std::string> targets;  // labels jumped to in the current function
+
+    bool isBarrier(const mips::MachineInstruction &inst) const;
+    // index of the next instruction, comments and labels not jumped to are skipped
+    size_t next(const std::vector<mips::MachineInstruction> &code, size_t pos) const;
+    bool isLabelAhead(const std::vector<mips::MachineInstruction> &code, size_t pos, const std::string &label) const;
+    static bool invertBranch(mips::MachineInstruction &inst);
+
+    void remove(std::vector<mips::MachineInstruction> &code, size_t pos, Rule rule);
+    void rewrite(mips::MachineInstruction &inst, const mips::MachineInstruction &with, Rule rule);
+
+    bool noEffect(std::vector<mips::MachineInstruction> &code);
+    bool storeLoad(std::vector<mips::MachineInstruction> &code);
+    bool knownConstant(std::vector<mips::MachineInstruction> &code);
+    bool jumpToNext(std::vector<mips::MachineInstruction> &code);
+    bool branchOverJump(std::vector<mips::MachineInstruction> &code);
+    bool unreachable(std::vector<mips::MachineInstruction> &code);
+};
+
+} // namespace backend
+
+#endif // PEEPHOLE_H
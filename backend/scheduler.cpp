@@ -0,0 +1,151 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#include <algorithm>
+
+#include "scheduler.h"
+
+
+namespace backend{
+
+Scheduler::Scheduler():
+    latencies()
+{
+
+}
+
+Scheduler::Scheduler(const Latencies &latencies):
+    latencies(latencies)
+{
+
+}
+
+void Scheduler::run(std::vector<mips::MachineInstruction> &code)
+{
+    size_t begin = 0;
+    for (size_t i = 0; i <= code.size(); i++){
+        if (i < code.size() && !isBoundary(code[i]))
+            continue;
+        if (i > begin + 1)
+            schedule(code, begin, i);
+        begin = i + 1;
+    }
+}
+
+unsigned Scheduler::getLatency(const mips::MachineInstruction &inst) const
+{
+    switch (inst.getOpcode()){
+    case mips::Opcode::LW: case mips::Opcode::LB: case mips::Opcode::LBU:
+        return latencies.load;
+    case mips::Opcode::MUL: case mips::Opcode::MULT:
+        return latencies.multiply;
+    case mips::Opcode::DIV:
+        return latencies.divide;
+    default:
+        return 1;
+    }
+}
+
+bool Scheduler::isBoundary(const mips::MachineInstruction &inst)
+{
+    return inst.isLabel() || inst.isCall() || inst.isConditionalBranch() || inst.isUnconditionalJump();
+}
+
+void Scheduler::buildGraph(std::vector<Node> &nodes, const mips::MachineInstruction *end) const
+{
+    std::vector<mips::RegisterSet> defs;
+    for (auto &node : nodes)
+        defs.push_back(node.code.back().getDefs());
+
+    for (size_t i = 0; i < nodes.size(); i++){
+        const mips::MachineInstruction &first = nodes[i].code.back();
+        for (size_t j = i + 1; j < nodes.size(); j++){
+            const mips::MachineInstruction &second = nodes[j].code.back();
+            unsigned latency = 0;
+            if ((defs[i] & second.getUses()).any())
+                latency = getLatency(first);
+            else if (first.conflictsWith(second))
+                latency = 1;
+
+            if (latency > 0){
+                nodes[i].successors.push_back(std::make_pair(j, latency));
+                nodes[j].predecessors++;
+            }
+        }
+    }
+
+    // height is the longest latency path from the node to the end of the block
+    mips::RegisterSet endUses = end != nullptr ? end->getUses() : mips::RegisterSet();
+    for (size_t i = nodes.size(); i-- > 0; ){
+        unsigned height = getLatency(nodes[i].code.back());
+        if (end != nullptr && end->isConditionalBranch() && (defs[i] & endUses).any())
+            height = std::max(height, latencies.branch);
+        for (auto &succ : nodes[i].successors)
+            height = std::max(height, succ.second + nodes[succ.first].height);
+        nodes[i].height = height;
+    }
+}
+
+void Scheduler::schedule(std::vector<mips::MachineInstruction> &code, size_t begin, size_t end) const
+{
+    std::vector<Node> nodes;
+    std::vector<mips::MachineInstruction> pending;
+    for (size_t i = begin; i < end; i++){
+        pending.push_back(code[i]);
+        if (!code[i].isComment()){
+            nodes.push_back(Node());
+            nodes.back().code.swap(pending);
+        }
+    }
+    if (nodes.size() < 2)
+        return;
+
+    buildGraph(nodes, end < code.size() ? &code[end] : nullptr);
+
+    std::vector<size_t> ready;
+    for (size_t i = 0; i < nodes.size(); i++){
+        if (nodes[i].predecessors == 0)
+            ready.push_back(i);
+    }
+
+    std::vector<mips::MachineInstruction> scheduled;
+    unsigned cycle = 0;
+    while (!ready.empty()){
+        // highest of the instructions whose operands are available, earlier one on a tie;
+        // if there is none, the pipeline stalls until the first of them can go
+        auto best = ready.end();
+        unsigned stall = ~0u;
+        for (auto it = ready.begin(); it != ready.end(); ++it){
+            const Node &node = nodes[*it];
+            if (node.earliest > cycle){
+                stall = std::min(stall, node.earliest);
+                continue;
+            }
+            if (best == ready.end() || node.height > nodes[*best].height
+                    || (node.height == nodes[*best].height && *it < *best))
+                best = it;
+        }
+        if (best == ready.end()){
+            cycle = stall;
+            continue;
+        }
+
+        Node &node = nodes[*best];
+        ready.erase(best);
+        scheduled.insert(scheduled.end(), node.code.begin(), node.code.end());
+        for (auto &succ : node.successors){
+            Node &next = nodes[succ.first];
+            next.earliest = std::max(next.earliest, cycle + succ.second);
+            if (--next.predecessors == 0)
+                ready.push_back(succ.first);
+        }
+        cycle++;
+    }
+
+    scheduled.insert(scheduled.end(), pending.begin(), pending.end());
+    std::copy(scheduled.begin(), scheduled.end(), code.begin() + begin);
+}
+
+} // namespace backend
@@ -0,0 +1,61 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <vector>
+
+#include "backend/machineinstruction.h"
+
+
+namespace backend{
+
+/**
+ * List scheduler reordering instructions inside basic blocks of the final machine code.
+ *
+ * Labels, jumps, branches and calls delimit the blocks and stay where they are. Dependences
+ * are built from registers (hi and lo included), memory accesses which may overlap and the
+ * order of I/O. Ready instructions are issued by the length of the longest latency path
+ * to the end of the block, so that loads and multiplications are started early and their
+ * results are not used by the very next instruction.
+ */
+class Scheduler
+{
+public:
+    // cycles after which a result can be used, other instructions take one
+    struct Latencies{
+        unsigned load = 2;
+        unsigned multiply = 4;  // mul, mult to mfhi and mflo
+        unsigned divide = 12;
+        unsigned branch = 2;    // result compared by the branch ending the block
+    };
+
+    Scheduler();
+    Scheduler(const Latencies &latencies);
+
+    void run(std::vector<mips::MachineInstruction> &code);
+
+private:
+    struct Node{
+        std::vector<mips::MachineInstruction> code;  // instruction with the comments preceding it
+        std::vector<std::pair<size_t, unsigned>> successors;  // node, latency
+        unsigned predecessors = 0;
+        unsigned height = 0;
+        unsigned earliest = 0;
+    };
+
+    Latencies latencies;
+
+    unsigned getLatency(const mips::MachineInstruction &inst) const;
+    static bool isBoundary(const mips::MachineInstruction &inst);
+
+    void buildGraph(std::vector<Node> &nodes, const mips::MachineInstruction *end) const;
+    void schedule(std::vector<mips::MachineInstruction> &code, size_t begin, size_t end) const;
+};
+
+} // namespace backend
+
+#endif // SCHEDULER_H
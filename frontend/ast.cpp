@@ -28,6 +28,12 @@ ir::Value* Variable::generateIrValue(ir::Builder& /*builder*/)
 	return _data->getIrValue();
 }
 
+ir::Value* ArrayElement::generateIrValue(ir::Builder& builder)
+{
+	ir::Value* indexValue = _index->generateIrValue(builder);
+	return builder.createLoadIndexed(_data->getIrValue(), indexValue);
+}
+
 ir::Value* Call::generateIrValue(ir::Builder& builder)
 {
 	std::vector<ir::Value*> paramValues;
@@ -158,6 +164,18 @@ ir::Value* BinaryExpression::generateIrValue(ir::Builder& builder)
 			resultValue = builder.createBinaryOperation<ir::BitwiseOrInstruction>(leftOperandValue, rightOperandValue,
 				Symbol::dataTypeToIrDataType(getDataType()));
 			break;
+		case Expression::Type::BIT_XOR:
+			resultValue = builder.createBinaryOperation<ir::BitwiseXorInstruction>(leftOperandValue, rightOperandValue,
+				Symbol::dataTypeToIrDataType(getDataType()));
+			break;
+		case Expression::Type::SHIFT_LEFT:
+			resultValue = builder.createBinaryOperation<ir::ShiftLeftInstruction>(leftOperandValue, rightOperandValue,
+				Symbol::dataTypeToIrDataType(getDataType()));
+			break;
+		case Expression::Type::SHIFT_RIGHT:
+			resultValue = builder.createBinaryOperation<ir::ShiftRightInstruction>(leftOperandValue, rightOperandValue,
+				Symbol::dataTypeToIrDataType(getDataType()));
+			break;
 		default:
 			return nullptr;
 	}
@@ -171,8 +189,23 @@ void AssignStatement::generateIr(ir::Builder& builder)
 	builder.createAssignment(_variable->getIrValue(), exprValue);
 }
 
+void ArrayElementAssignStatement::generateIr(ir::Builder& builder)
+{
+	ir::Value* indexValue = _index->generateIrValue(builder);
+	ir::Value* exprValue = _expression->generateIrValue(builder);
+	builder.createStoreIndexed(_variable->getIrValue(), indexValue, exprValue);
+}
+
 void Declaration::generateIr(ir::Builder& builder)
 {
+	// Arrays are zeroed when declared, their elements are never held in registers
+	if (_variable->isArray())
+	{
+		_variable->setIrValue(builder.createArrayDeclaration(_variable->getName(),
+			Symbol::dataTypeToIrDataType(_variable->getDataType()), _variable->getArraySize()));
+		return;
+	}
+
 	ir::Value* varValue = builder.createDeclaration(_variable->getName(), Symbol::dataTypeToIrDataType(_variable->getDataType()));
 	_variable->setIrValue(varValue);
 
@@ -67,7 +67,11 @@ public:
 		BIT_AND,
 		BIT_OR,
 		BIT_NOT,
-		NEG
+		NEG,
+		ARRAY_ELEMENT,
+		BIT_XOR,
+		SHIFT_LEFT,
+		SHIFT_RIGHT
 	};
 
 	Expression(const Expression&) = delete;
@@ -157,6 +161,26 @@ private:
 	Variable& operator =(const Variable&);
 };
 
+class ArrayElement : public TerminalExpression<VariableSymbol*>
+{
+public:
+	ArrayElement(VariableSymbol* data, Expression* index) :
+		TerminalExpression<VariableSymbol*>(Type::ARRAY_ELEMENT, data->getDataType(), data), _index(index) {}
+	ArrayElement(const ArrayElement&) = delete;
+	virtual ~ArrayElement()
+	{
+		delete _index;
+	}
+
+	virtual Generates generates() override { return Generates::VALUE; }
+	virtual ir::Value* generateIrValue(ir::Builder& builder) override;
+
+private:
+	ArrayElement& operator =(const ArrayElement&);
+
+	Expression* _index;
+};
+
 class Call : public TerminalExpression<FunctionSymbol*>
 {
 public:
@@ -295,6 +319,29 @@ private:
 	Expression* _expression;
 };
 
+class ArrayElementAssignStatement : public Statement
+{
+public:
+	ArrayElementAssignStatement(VariableSymbol* variable, Expression* index, Expression* expression) : Statement(),
+		_variable(variable), _index(index), _expression(expression) {}
+	ArrayElementAssignStatement(const ArrayElementAssignStatement&) = delete;
+	virtual ~ArrayElementAssignStatement()
+	{
+		delete _index;
+		delete _expression;
+	}
+
+	virtual Generates generates() override { return Generates::NOTHING; }
+	virtual void generateIr(ir::Builder& builder) override;
+
+private:
+	ArrayElementAssignStatement& operator =(const ArrayElementAssignStatement&);
+
+	VariableSymbol* _variable;
+	Expression* _index;
+	Expression* _expression;
+};
+
 class Declaration : public ASTNode
 {
 public:
@@ -0,0 +1,99 @@
+#define BUILTINS_LIST "print", "read_char", "read_int", "read_string", "get_at", "set_at", "strcat", "strlen", "substr", 
+#define OPS_LIST {",", COMMA}, {";", SEMICOLON}, {"=", ASSIGN}, {"(", LEFT_PAREN}, {")", RIGHT_PAREN}, {"{", LEFT_CBRACE}, {"}", RIGHT_CBRACE}, {"[", LEFT_BRACKET}, {"]", RIGHT_BRACKET}, {"+", PLUS}, {"-", MINUS}, {"*", MULTIPLY}, {"/", DIVIDE}, {"%", MODULO}, {"!", NOT}, {"<", LESS}, {"<=", LESS_EQUAL}, {"<<", SHIFT_LEFT}, {">", GREATER}, {">=", GREATER_EQUAL}, {">>", SHIFT_RIGHT}, {"==", EQUAL}, {"!=", NOT_EQUAL}, {"&&", AND}, {"||", OR}, {"&", BIT_AND}, {"|", BIT_OR}, {"^", BIT_XOR}, {"~", BIT_NOT}, 
+// Hand-written stand-in for the flex generated lexer (sandbox has no flex).
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <set>
+#include <map>
+#include "frontend/ast.h"
+#include "frontend/c_parser.h"
+
+FILE* yyin = nullptr;
+extern void finalize(int exitCode);
+static std::vector<int> pushback;
+static int get() { if (!pushback.empty()) { int c = pushback.back(); pushback.pop_back(); return c; } return yyin ? fgetc(yyin) : EOF; }
+static void unget(int c) { pushback.push_back(c); }
+int yylex_destroy() { pushback.clear(); yyin = nullptr; return 0; }
+
+static const char* builtins[] = { BUILTINS_LIST nullptr };
+
+int yylex()
+{
+	for (;;)
+	{
+		int c = get();
+		if (c == EOF) return 0;
+		if (c == ' ' || c == '\r' || c == '\n' || c == '\t') continue;
+		if (c == '/')
+		{
+			int d = get();
+			if (d == '/') { while ((c = get()) != EOF && c != '\n'); if (c == '\n') unget(c); continue; }
+			if (d == '*')
+			{
+				int p = 0;
+				for (;;) { c = get(); if (c == EOF) return 0; if (p == '*' && c == '/') break; p = c; }
+				continue;
+			}
+			unget(d); return DIVIDE;
+		}
+		if (c == '\'')
+		{
+			char ch; c = get();
+			if (c == '\\') {
+				int d = get();
+				if (d == '\'') ch = '\''; else if (d == '"') ch = '"'; else if (d == '\\') ch = '\\';
+				else if (d == 't') ch = '\t'; else if (d == 'n') ch = '\n';
+				else { finalize(1); return 0; }
+			} else if (c == EOF || c == '\'' || c == '"' || c == '\t' || c == '\n') { finalize(1); return 0; }
+			else ch = c;
+			if (get() != '\'') { finalize(1); return 0; }
+			yylval.charValue = ch; return CHAR_LIT;
+		}
+		if (c == '"')
+		{
+			std::string s;
+			for (;;) {
+				c = get();
+				if (c == EOF) return 0;
+				if (c == '"') break;
+				if (c == '\'') { finalize(1); return 0; }
+				if (c == '\\') {
+					int d = get();
+					if (d == '\'' ) s += "\\'"; else if (d == '"') s += "\\\""; else if (d == '\\') s += "\\\\";
+					else if (d == 't') s += "\\t"; else if (d == 'n') s += "\\n"; else unget(d);
+					continue;
+				}
+				s += (char)c;
+			}
+			yylval.strValue = new std::string(s); return STRING_LIT;
+		}
+		struct Op { const char* s; int tok; };
+		static const Op ops[] = { OPS_LIST {nullptr, 0} };
+		{
+			int best = -1; size_t bestLen = 0;
+			std::string buf(1, (char)c);
+			int d = get(); if (d != EOF) buf += (char)d;
+			for (int i = 0; ops[i].s; ++i) {
+				size_t l = strlen(ops[i].s);
+				if (l <= buf.size() && buf.compare(0, l, ops[i].s) == 0 && l > bestLen) { best = i; bestLen = l; }
+			}
+			if (best >= 0) { if (bestLen == 1 && d != EOF) unget(d); return ops[best].tok; }
+			if (d != EOF) unget(d);
+		}
+		if (isdigit(c)) { std::string s(1, (char)c); while (isdigit(c = get())) s += (char)c; unget(c); yylval.intValue = atoi(s.c_str()); return INT_LIT; }
+		if (isalpha(c) || c == '_')
+		{
+			std::string s(1, (char)c); while (isalnum(c = get()) || c == '_') s += (char)c; unget(c);
+			static const std::map<std::string, int> kw = { {"if", IF}, {"else", ELSE}, {"while", WHILE}, {"for", FOR}, {"return", RETURN}, {"void", VOID},
+				{"unsigned", RESERVED}, {"short", RESERVED}, {"break", RESERVED}, {"continue", RESERVED} };
+			auto it = kw.find(s); if (it != kw.end()) return it->second;
+			if (s == "int" || s == "char" || s == "string") { yylval.strValue = new std::string(s); return TYPE; }
+			for (int i = 0; builtins[i]; ++i) if (s == builtins[i]) { yylval.strValue = new std::string(s); return BUILTIN; }
+			yylval.strValue = new std::string(s); return ID;
+		}
+		finalize(1); return 0;
+	}
+}
@@ -0,0 +1,3382 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison implementation for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* C LALR(1) parser skeleton written by Richard Stallman, by
+   simplifying the original so-called "semantic" parser.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+/* All symbols defined below should begin with yy or YY, to avoid
+   infringing on user name space.  This should be done even for local
+   variables, as they might otherwise be expanded by user macros.
+   There are some unavoidable exceptions within include files to
+   define necessary library symbols; they are noted "INFRINGES ON
+   USER NAME SPACE" below.  */
+
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
+
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
+
+/* Skeleton name.  */
+#define YYSKELETON_NAME "yacc.c"
+
+/* Pure parsers.  */
+#define YYPURE 0
+
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 1 "c_parser.y"
+
+#include <algorithm>
+#include <vector>
+#include <cstdarg>
+
+#include "frontend/ast.h"
+#include "frontend/context.h"
+#include "frontend/name_mangler.h"
+
+using namespace frontend;
+
+extern int yylex();
+extern void yyerror(const char* e, ...);
+
+extern Program program;
+extern Context context;
+
+extern void finalize(int exitCode);
+
+#line 91 "c_parser.cpp"
+
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
+
+#include "c_parser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_COMMA = 3,                      /* COMMA  */
+  YYSYMBOL_SEMICOLON = 4,                  /* SEMICOLON  */
+  YYSYMBOL_ASSIGN = 5,                     /* ASSIGN  */
+  YYSYMBOL_LEFT_PAREN = 6,                 /* LEFT_PAREN  */
+  YYSYMBOL_RIGHT_PAREN = 7,                /* RIGHT_PAREN  */
+  YYSYMBOL_LEFT_CBRACE = 8,                /* LEFT_CBRACE  */
+  YYSYMBOL_RIGHT_CBRACE = 9,               /* RIGHT_CBRACE  */
+  YYSYMBOL_LEFT_BRACKET = 10,              /* LEFT_BRACKET  */
+  YYSYMBOL_RIGHT_BRACKET = 11,             /* RIGHT_BRACKET  */
+  YYSYMBOL_PLUS = 12,                      /* PLUS  */
+  YYSYMBOL_MINUS = 13,                     /* MINUS  */
+  YYSYMBOL_MULTIPLY = 14,                  /* MULTIPLY  */
+  YYSYMBOL_DIVIDE = 15,                    /* DIVIDE  */
+  YYSYMBOL_MODULO = 16,                    /* MODULO  */
+  YYSYMBOL_NOT = 17,                       /* NOT  */
+  YYSYMBOL_LESS = 18,                      /* LESS  */
+  YYSYMBOL_LESS_EQUAL = 19,                /* LESS_EQUAL  */
+  YYSYMBOL_GREATER = 20,                   /* GREATER  */
+  YYSYMBOL_GREATER_EQUAL = 21,             /* GREATER_EQUAL  */
+  YYSYMBOL_EQUAL = 22,                     /* EQUAL  */
+  YYSYMBOL_NOT_EQUAL = 23,                 /* NOT_EQUAL  */
+  YYSYMBOL_AND = 24,                       /* AND  */
+  YYSYMBOL_OR = 25,                        /* OR  */
+  YYSYMBOL_IF = 26,                        /* IF  */
+  YYSYMBOL_ELSE = 27,                      /* ELSE  */
+  YYSYMBOL_WHILE = 28,                     /* WHILE  */
+  YYSYMBOL_FOR = 29,                       /* FOR  */
+  YYSYMBOL_RETURN = 30,                    /* RETURN  */
+  YYSYMBOL_VOID = 31,                      /* VOID  */
+  YYSYMBOL_BIT_AND = 32,                   /* BIT_AND  */
+  YYSYMBOL_BIT_OR = 33,                    /* BIT_OR  */
+  YYSYMBOL_BIT_XOR = 34,                   /* BIT_XOR  */
+  YYSYMBOL_BIT_NOT = 35,                   /* BIT_NOT  */
+  YYSYMBOL_SHIFT_LEFT = 36,                /* SHIFT_LEFT  */
+  YYSYMBOL_SHIFT_RIGHT = 37,               /* SHIFT_RIGHT  */
+  YYSYMBOL_RESERVED = 38,                  /* RESERVED  */
+  YYSYMBOL_INT_LIT = 39,                   /* INT_LIT  */
+  YYSYMBOL_CHAR_LIT = 40,                  /* CHAR_LIT  */
+  YYSYMBOL_STRING_LIT = 41,                /* STRING_LIT  */
+  YYSYMBOL_ID = 42,                        /* ID  */
+  YYSYMBOL_TYPE = 43,                      /* TYPE  */
+  YYSYMBOL_BUILTIN = 44,                   /* BUILTIN  */
+  YYSYMBOL_UNARY_PLUS = 45,                /* UNARY_PLUS  */
+  YYSYMBOL_UNARY_MINUS = 46,               /* UNARY_MINUS  */
+  YYSYMBOL_YYACCEPT = 47,                  /* $accept  */
+  YYSYMBOL_program = 48,                   /* program  */
+  YYSYMBOL_body = 49,                      /* body  */
+  YYSYMBOL_func_decl = 50,                 /* func_decl  */
+  YYSYMBOL_func_impl = 51,                 /* func_impl  */
+  YYSYMBOL_52_1 = 52,                      /* $@1  */
+  YYSYMBOL_53_2 = 53,                      /* $@2  */
+  YYSYMBOL_54_3 = 54,                      /* $@3  */
+  YYSYMBOL_55_4 = 55,                      /* $@4  */
+  YYSYMBOL_decl_param_list = 56,           /* decl_param_list  */
+  YYSYMBOL_impl_param_list = 57,           /* impl_param_list  */
+  YYSYMBOL_stmts = 58,                     /* stmts  */
+  YYSYMBOL_stmt = 59,                      /* stmt  */
+  YYSYMBOL_stmt_list = 60,                 /* stmt_list  */
+  YYSYMBOL_assign_stmt = 61,               /* assign_stmt  */
+  YYSYMBOL_decl_stmt = 62,                 /* decl_stmt  */
+  YYSYMBOL_63_5 = 63,                      /* $@5  */
+  YYSYMBOL_decl_id_list = 64,              /* decl_id_list  */
+  YYSYMBOL_decl_id = 65,                   /* decl_id  */
+  YYSYMBOL_decl_init_expr = 66,            /* decl_init_expr  */
+  YYSYMBOL_if_stmt = 67,                   /* if_stmt  */
+  YYSYMBOL_68_6 = 68,                      /* $@6  */
+  YYSYMBOL_69_7 = 69,                      /* $@7  */
+  YYSYMBOL_while_stmt = 70,                /* while_stmt  */
+  YYSYMBOL_71_8 = 71,                      /* $@8  */
+  YYSYMBOL_for_stmt = 72,                  /* for_stmt  */
+  YYSYMBOL_73_9 = 73,                      /* $@9  */
+  YYSYMBOL_for_init = 74,                  /* for_init  */
+  YYSYMBOL_for_cond = 75,                  /* for_cond  */
+  YYSYMBOL_for_iter = 76,                  /* for_iter  */
+  YYSYMBOL_return_stmt = 77,               /* return_stmt  */
+  YYSYMBOL_call_stmt = 78,                 /* call_stmt  */
+  YYSYMBOL_empty_stmt = 79,                /* empty_stmt  */
+  YYSYMBOL_exprs = 80,                     /* exprs  */
+  YYSYMBOL_expr_list = 81,                 /* expr_list  */
+  YYSYMBOL_expr = 82                       /* expr  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
+
+
+
+
+#ifdef short
+# undef short
+#endif
+
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
+
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
+#else
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
+#endif
+
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
+#else
+typedef short yytype_uint8;
+#endif
+
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
+#else
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
+#endif
+
+#ifndef YYSIZE_T
+# ifdef __SIZE_TYPE__
+#  define YYSIZE_T __SIZE_TYPE__
+# elif defined size_t
+#  define YYSIZE_T size_t
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYSIZE_T size_t
+# else
+#  define YYSIZE_T unsigned
+# endif
+#endif
+
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_uint8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
+
+#ifndef YY_
+# if defined YYENABLE_NLS && YYENABLE_NLS
+#  if ENABLE_NLS
+#   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
+#  endif
+# endif
+# ifndef YY_
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
+# endif
+#endif
+
+/* Suppress unused-variable warnings by "using" E.  */
+#if ! defined lint || defined __GNUC__
+# define YY_USE(E) ((void) (E))
+#else
+# define YY_USE(E) /* empty */
+#endif
+
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
+#else
+# define YY_INITIAL_VALUE(Value) Value
+#endif
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
+
+/* The parser invokes alloca or malloc; define the necessary symbols.  */
+
+# ifdef YYSTACK_USE_ALLOCA
+#  if YYSTACK_USE_ALLOCA
+#   ifdef __GNUC__
+#    define YYSTACK_ALLOC __builtin_alloca
+#   elif defined __BUILTIN_VA_ARG_INCR
+#    include <alloca.h> /* INFRINGES ON USER NAME SPACE */
+#   elif defined _AIX
+#    define YYSTACK_ALLOC __alloca
+#   elif defined _MSC_VER
+#    include <malloc.h> /* INFRINGES ON USER NAME SPACE */
+#    define alloca _alloca
+#   else
+#    define YYSTACK_ALLOC alloca
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
+#     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
+#     endif
+#    endif
+#   endif
+#  endif
+# endif
+
+# ifdef YYSTACK_ALLOC
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+    /* The OS might guarantee only one guard page at the bottom of the stack,
+       and a page size can be as small as 4096 bytes.  So we cannot safely
+       invoke alloca (N) if N exceeds 4096.  Use a slightly smaller number
+       to allow for a few compiler-allocated temporary stack slots.  */
+#   define YYSTACK_ALLOC_MAXIMUM 4032 /* reasonable circa 2006 */
+#  endif
+# else
+#  define YYSTACK_ALLOC YYMALLOC
+#  define YYSTACK_FREE YYFREE
+#  ifndef YYSTACK_ALLOC_MAXIMUM
+#   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
+#  endif
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
+       && ! ((defined YYMALLOC || defined malloc) \
+             && (defined YYFREE || defined free)))
+#   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
+#   endif
+#  endif
+#  ifndef YYMALLOC
+#   define YYMALLOC malloc
+#   if ! defined malloc && ! defined EXIT_SUCCESS
+void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+#  ifndef YYFREE
+#   define YYFREE free
+#   if ! defined free && ! defined EXIT_SUCCESS
+void free (void *); /* INFRINGES ON USER NAME SPACE */
+#   endif
+#  endif
+# endif
+#endif /* !defined yyoverflow */
+
+#if (! defined yyoverflow \
+     && (! defined __cplusplus \
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+
+/* A type that is properly aligned for any stack member.  */
+union yyalloc
+{
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
+
+/* The size of the maximum gap between one aligned stack and the next.  */
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
+
+/* The size of an array large to enough to hold all stacks, each with
+   N elements.  */
+# define YYSTACK_BYTES(N) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
+      + YYSTACK_GAP_MAXIMUM)
+
+# define YYCOPY_NEEDED 1
+
+/* Relocate STACK from its old location to the new one.  The
+   local variables YYSIZE and YYSTACKSIZE give the old and new number of
+   elements in the stack, and YYPTR gives the new location of the
+   stack.  Advance YYPTR to a properly aligned location for the next
+   stack.  */
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
+
+#endif
+
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
+/* YYFINAL -- State number of the termination state.  */
+#define YYFINAL  9
+/* YYLAST -- Last index in YYTABLE.  */
+#define YYLAST   562
+
+/* YYNTOKENS -- Number of terminals.  */
+#define YYNTOKENS  47
+/* YYNNTS -- Number of nonterminals.  */
+#define YYNNTS  36
+/* YYNRULES -- Number of rules.  */
+#define YYNRULES  99
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  211
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   301
+
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
+{
+       0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     1,     2,     3,     4,
+       5,     6,     7,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
+      45,    46
+};
+
+#if YYDEBUG
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,    75,    75,    76,    79,    80,    81,    82,    85,   101,
+     119,   133,   151,   151,   173,   173,   211,   211,   231,   231,
+     268,   269,   272,   273,   276,   277,   280,   281,   282,   283,
+     284,   285,   286,   287,   290,   295,   303,   336,   380,   380,
+     388,   389,   392,   433,   487,   488,   491,   502,   491,   513,
+     513,   531,   530,   548,   581,   584,   585,   588,   621,   622,
+     625,   637,   650,   708,   881,   884,   885,   888,   889,   892,
+     904,   917,   929,   941,   953,   965,   977,   989,  1001,  1013,
+    1025,  1037,  1049,  1061,  1073,  1085,  1097,  1109,  1120,  1131,
+    1142,  1153,  1177,  1178,  1237,  1420,  1451,  1481,  1482,  1483
+};
+#endif
+
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
+/* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
+   First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
+static const char *const yytname[] =
+{
+  "\"end of file\"", "error", "\"invalid token\"", "COMMA", "SEMICOLON",
+  "ASSIGN", "LEFT_PAREN", "RIGHT_PAREN", "LEFT_CBRACE", "RIGHT_CBRACE",
+  "LEFT_BRACKET", "RIGHT_BRACKET", "PLUS", "MINUS", "MULTIPLY", "DIVIDE",
+  "MODULO", "NOT", "LESS", "LESS_EQUAL", "GREATER", "GREATER_EQUAL",
+  "EQUAL", "NOT_EQUAL", "AND", "OR", "IF", "ELSE", "WHILE", "FOR",
+  "RETURN", "VOID", "BIT_AND", "BIT_OR", "BIT_XOR", "BIT_NOT",
+  "SHIFT_LEFT", "SHIFT_RIGHT", "RESERVED", "INT_LIT", "CHAR_LIT",
+  "STRING_LIT", "ID", "TYPE", "BUILTIN", "UNARY_PLUS", "UNARY_MINUS",
+  "$accept", "program", "body", "func_decl", "func_impl", "$@1", "$@2",
+  "$@3", "$@4", "decl_param_list", "impl_param_list", "stmts", "stmt",
+  "stmt_list", "assign_stmt", "decl_stmt", "$@5", "decl_id_list",
+  "decl_id", "decl_init_expr", "if_stmt", "$@6", "$@7", "while_stmt",
+  "$@8", "for_stmt", "$@9", "for_init", "for_cond", "for_iter",
+  "return_stmt", "call_stmt", "empty_stmt", "exprs", "expr_list", "expr", YY_NULLPTR
+};
+
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
+
+#define YYPACT_NINF (-50)
+
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
+
+#define YYTABLE_NINF (-1)
+
+#define yytable_value_is_error(Yyn) \
+  0
+
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
+static const yytype_int16 yypact[] =
+{
+     -24,   -18,   -11,    18,   -24,   -50,   -50,    37,    39,   -50,
+     -50,   -50,   -20,    56,    45,    36,     2,     7,    72,    91,
+     110,    81,   -50,    52,    84,    57,   -50,    97,   102,   -50,
+     -50,   106,   -50,   -50,    94,   130,   -50,   131,   -50,   133,
+       4,   -50,     4,     4,     4,   -50,   137,   142,   143,     0,
+      10,   -50,   144,   145,   -50,     4,   -50,   -50,   -50,   -50,
+     -50,   -50,   -50,   -50,   146,   147,   148,    90,    90,   116,
+     -50,    80,    90,    90,    90,    90,   -50,   -50,   -50,   127,
+     153,   167,    90,    90,    90,   118,    90,   -50,   -50,   -50,
+     -50,   -50,   247,   275,   156,   158,   159,   303,   -50,   -50,
+     -50,   -50,    90,    90,    90,   -50,    90,    90,    90,    90,
+      90,    90,    90,    90,    90,    90,    90,    90,    90,    90,
+      90,    90,    90,    90,   193,   160,   149,   383,   330,    46,
+      55,   -50,   161,   -50,   -50,    90,    90,    90,   -50,   163,
+     357,   165,   112,   112,   -50,   -50,   -50,    68,    68,    68,
+      68,   525,   525,   435,   409,   513,   461,   487,    96,    96,
+     -50,   173,    90,   179,    90,   126,   -50,   118,   -50,   189,
+     186,   187,   383,   192,   383,   -50,   -50,   -50,   -50,   -50,
+     383,    90,   383,   191,   -50,   -50,     4,     4,   134,   219,
+     -50,   201,   210,    44,   213,   383,   -50,   171,   -50,    90,
+     -50,   -50,   383,   214,   216,     4,     4,   212,   227,   -50,
+     -50
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       3,     0,     0,     0,     2,     6,     7,     0,     0,     1,
+       4,     5,     0,     0,     0,    21,     0,     0,     0,     0,
+       0,    16,    23,     0,     0,     0,    18,    12,     0,    14,
+      10,     0,    20,    11,     0,     0,     8,     0,     9,     0,
+      25,    22,    25,    25,    25,    64,     0,     0,     0,     0,
+       0,    38,     0,     0,    35,    24,    26,    27,    28,    29,
+      30,    31,    32,    33,     0,     0,     0,     0,     0,    54,
+      61,     0,     0,     0,     0,     0,    97,    98,    99,    95,
+       0,     0,     0,    66,     0,     0,    66,    17,    34,    19,
+      13,    15,     0,     0,     0,     0,     0,     0,    89,    90,
+      87,    88,    66,     0,    66,    60,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,    65,    68,     0,    45,
+       0,    41,     0,    46,    49,     0,    56,     0,    92,     0,
+       0,     0,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    85,    86,    80,    81,    82,    83,    84,
+      36,     0,     0,     0,     0,     0,    42,     0,    39,     0,
+       0,     0,    53,     0,    55,    91,    93,    96,    94,    62,
+      67,     0,    44,     0,    40,    63,    25,    25,    59,     0,
+      43,     0,     0,    95,     0,    58,    37,     0,    50,     0,
+      51,    47,    57,     0,     0,    25,    25,     0,     0,    52,
+      48
+};
+
+/* YYPGOTO[NTERM-NUM].  */
+static const yytype_int16 yypgoto[] =
+{
+     -50,   -50,   -50,   224,   241,   -50,   -50,   -50,   -50,   233,
+     234,   -42,   194,   -50,   -50,   -50,   -50,   -50,    83,   -50,
+     -50,   -50,   -50,   -50,   -50,   -50,   -50,   -50,   -50,   -50,
+     -50,   -50,   -50,   -49,   -50,   -46
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_uint8 yydefgoto[] =
+{
+       0,     3,     4,     5,     6,    37,    39,    31,    35,    16,
+      17,    53,    54,    55,    56,    57,    85,   130,   131,   166,
+      58,   170,   204,    59,   171,    60,   203,    95,   173,   194,
+      61,    62,    63,   125,   126,   127
+};
+
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_uint8 yytable[] =
+{
+      64,    65,    66,    81,    70,    23,    71,     1,    45,    24,
+      25,    14,    72,    73,    26,    82,    83,    74,     9,     2,
+      84,    92,    93,    15,     7,    97,    98,    99,   100,   101,
+      46,     8,    47,    48,    49,    75,   124,   132,   128,    76,
+      77,    78,    79,    12,    80,    13,    50,    51,    52,   199,
+     102,   164,    21,   139,   103,   141,   165,   140,   167,   168,
+     142,   143,   144,   145,   146,   147,   148,   149,   150,   151,
+     152,   153,   154,   155,   156,   157,   158,   159,    22,    27,
+     106,   107,   108,   109,   110,    30,    71,    18,    33,   172,
+     174,   175,    72,    73,    23,    32,    71,    74,    28,    15,
+      34,    36,    72,    73,   122,   123,    38,    74,   106,   107,
+     108,   109,   110,    25,    40,    75,   180,    29,   182,    76,
+      77,    78,    79,    96,    80,    75,   108,   109,   110,    76,
+      77,    78,    79,   102,    80,   189,    41,   103,    42,    43,
+      71,    44,   195,    67,   191,   192,    72,    73,    68,    69,
+      86,    74,   162,   202,    87,    89,    90,    91,    94,   104,
+     129,   135,   136,   207,   208,   183,   137,   161,   169,    75,
+     176,   105,   178,    76,    77,    78,   193,   179,    80,   106,
+     107,   108,   109,   110,   181,   111,   112,   113,   114,   115,
+     116,   117,   118,   185,   186,   187,   188,   160,   201,   119,
+     120,   121,   190,   122,   123,   106,   107,   108,   109,   110,
+     197,   111,   112,   113,   114,   115,   116,   117,   118,   198,
+     200,   209,   205,   196,   206,   119,   120,   121,    10,   122,
+     123,   106,   107,   108,   109,   110,   210,   111,   112,   113,
+     114,   115,   116,   117,   118,    11,    19,    20,     0,    88,
+     184,   119,   120,   121,   133,   122,   123,     0,     0,   106,
+     107,   108,   109,   110,     0,   111,   112,   113,   114,   115,
+     116,   117,   118,     0,     0,     0,     0,     0,     0,   119,
+     120,   121,   134,   122,   123,     0,     0,   106,   107,   108,
+     109,   110,     0,   111,   112,   113,   114,   115,   116,   117,
+     118,     0,     0,     0,     0,     0,     0,   119,   120,   121,
+     138,   122,   123,     0,     0,   106,   107,   108,   109,   110,
+       0,   111,   112,   113,   114,   115,   116,   117,   118,     0,
+       0,     0,     0,     0,     0,   119,   120,   121,     0,   122,
+     123,   163,   106,   107,   108,   109,   110,     0,   111,   112,
+     113,   114,   115,   116,   117,   118,     0,     0,     0,     0,
+       0,     0,   119,   120,   121,     0,   122,   123,   177,   106,
+     107,   108,   109,   110,     0,   111,   112,   113,   114,   115,
+     116,   117,   118,     0,     0,     0,     0,     0,     0,   119,
+     120,   121,     0,   122,   123,   106,   107,   108,   109,   110,
+       0,   111,   112,   113,   114,   115,   116,   117,   118,     0,
+       0,     0,     0,     0,     0,   119,   120,   121,     0,   122,
+     123,   106,   107,   108,   109,   110,     0,   111,   112,   113,
+     114,   115,   116,   117,     0,     0,     0,     0,     0,     0,
+       0,   119,   120,   121,     0,   122,   123,   106,   107,   108,
+     109,   110,     0,   111,   112,   113,   114,   115,   116,     0,
+       0,     0,     0,     0,     0,     0,     0,   119,   120,   121,
+       0,   122,   123,   106,   107,   108,   109,   110,     0,   111,
+     112,   113,   114,   115,   116,     0,     0,     0,     0,     0,
+       0,     0,     0,   119,     0,   121,     0,   122,   123,   106,
+     107,   108,   109,   110,     0,   111,   112,   113,   114,   115,
+     116,     0,     0,     0,     0,     0,     0,     0,     0,   119,
+       0,     0,     0,   122,   123,   106,   107,   108,   109,   110,
+       0,   111,   112,   113,   114,   115,   116,   106,   107,   108,
+     109,   110,     0,   111,   112,   113,   114,     0,     0,   122,
+     123,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,   122,   123
+};
+
+static const yytype_int16 yycheck[] =
+{
+      42,    43,    44,    49,     4,     3,     6,    31,     4,     7,
+       3,    31,    12,    13,     7,     5,     6,    17,     0,    43,
+      10,    67,    68,    43,    42,    71,    72,    73,    74,    75,
+      26,    42,    28,    29,    30,    35,    82,    86,    84,    39,
+      40,    41,    42,     6,    44,     6,    42,    43,    44,     5,
+       6,     5,     7,   102,    10,   104,    10,   103,     3,     4,
+     106,   107,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,   122,   123,    42,     7,
+      12,    13,    14,    15,    16,     4,     6,    31,     4,   135,
+     136,   137,    12,    13,     3,    43,     6,    17,     7,    43,
+      43,     4,    12,    13,    36,    37,     4,    17,    12,    13,
+      14,    15,    16,     3,     8,    35,   162,     7,   164,    39,
+      40,    41,    42,    43,    44,    35,    14,    15,    16,    39,
+      40,    41,    42,     6,    44,   181,    42,    10,     8,     8,
+       6,     8,   188,     6,   186,   187,    12,    13,     6,     6,
+       6,    17,     3,   199,     9,     9,     9,     9,    42,     6,
+      42,     5,     4,   205,   206,    39,     7,     7,     7,    35,
+       7,     4,     7,    39,    40,    41,    42,     4,    44,    12,
+      13,    14,    15,    16,     5,    18,    19,    20,    21,    22,
+      23,    24,    25,     4,     8,     8,     4,     4,    27,    32,
+      33,    34,    11,    36,    37,    12,    13,    14,    15,    16,
+       9,    18,    19,    20,    21,    22,    23,    24,    25,     9,
+       7,     9,     8,     4,     8,    32,    33,    34,     4,    36,
+      37,    12,    13,    14,    15,    16,     9,    18,    19,    20,
+      21,    22,    23,    24,    25,     4,    13,    13,    -1,    55,
+     167,    32,    33,    34,     7,    36,    37,    -1,    -1,    12,
+      13,    14,    15,    16,    -1,    18,    19,    20,    21,    22,
+      23,    24,    25,    -1,    -1,    -1,    -1,    -1,    -1,    32,
+      33,    34,     7,    36,    37,    -1,    -1,    12,    13,    14,
+      15,    16,    -1,    18,    19,    20,    21,    22,    23,    24,
+      25,    -1,    -1,    -1,    -1,    -1,    -1,    32,    33,    34,
+       7,    36,    37,    -1,    -1,    12,    13,    14,    15,    16,
+      -1,    18,    19,    20,    21,    22,    23,    24,    25,    -1,
+      -1,    -1,    -1,    -1,    -1,    32,    33,    34,    -1,    36,
+      37,    11,    12,    13,    14,    15,    16,    -1,    18,    19,
+      20,    21,    22,    23,    24,    25,    -1,    -1,    -1,    -1,
+      -1,    -1,    32,    33,    34,    -1,    36,    37,    11,    12,
+      13,    14,    15,    16,    -1,    18,    19,    20,    21,    22,
+      23,    24,    25,    -1,    -1,    -1,    -1,    -1,    -1,    32,
+      33,    34,    -1,    36,    37,    12,    13,    14,    15,    16,
+      -1,    18,    19,    20,    21,    22,    23,    24,    25,    -1,
+      -1,    -1,    -1,    -1,    -1,    32,    33,    34,    -1,    36,
+      37,    12,    13,    14,    15,    16,    -1,    18,    19,    20,
+      21,    22,    23,    24,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    32,    33,    34,    -1,    36,    37,    12,    13,    14,
+      15,    16,    -1,    18,    19,    20,    21,    22,    23,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    32,    33,    34,
+      -1,    36,    37,    12,    13,    14,    15,    16,    -1,    18,
+      19,    20,    21,    22,    23,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    32,    -1,    34,    -1,    36,    37,    12,
+      13,    14,    15,    16,    -1,    18,    19,    20,    21,    22,
+      23,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    32,
+      -1,    -1,    -1,    36,    37,    12,    13,    14,    15,    16,
+      -1,    18,    19,    20,    21,    22,    23,    12,    13,    14,
+      15,    16,    -1,    18,    19,    20,    21,    -1,    -1,    36,
+      37,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    36,    37
+};
+
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
+{
+       0,    31,    43,    48,    49,    50,    51,    42,    42,     0,
+      50,    51,     6,     6,    31,    43,    56,    57,    31,    56,
+      57,     7,    42,     3,     7,     3,     7,     7,     7,     7,
+       4,    54,    43,     4,    43,    55,     4,    52,     4,    53,
+       8,    42,     8,     8,     8,     4,    26,    28,    29,    30,
+      42,    43,    44,    58,    59,    60,    61,    62,    67,    70,
+      72,    77,    78,    79,    58,    58,    58,     6,     6,     6,
+       4,     6,    12,    13,    17,    35,    39,    40,    41,    42,
+      44,    82,     5,     6,    10,    63,     6,     9,    59,     9,
+       9,     9,    82,    82,    42,    74,    43,    82,    82,    82,
+      82,    82,     6,    10,     6,     4,    12,    13,    14,    15,
+      16,    18,    19,    20,    21,    22,    23,    24,    25,    32,
+      33,    34,    36,    37,    82,    80,    81,    82,    82,    42,
+      64,    65,    80,     7,     7,     5,     4,     7,     7,    80,
+      82,    80,    82,    82,    82,    82,    82,    82,    82,    82,
+      82,    82,    82,    82,    82,    82,    82,    82,    82,    82,
+       4,     7,     3,    11,     5,    10,    66,     3,     4,     7,
+      68,    71,    82,    75,    82,    82,     7,    11,     7,     4,
+      82,     5,    82,    39,    65,     4,     8,     8,     4,    82,
+      11,    58,    58,    42,    76,    82,     4,     9,     9,     5,
+       7,    27,    82,    73,    69,     8,     8,    58,    58,     9,
+       9
+};
+
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    47,    48,    48,    49,    49,    49,    49,    50,    50,
+      50,    50,    52,    51,    53,    51,    54,    51,    55,    51,
+      56,    56,    57,    57,    58,    58,    59,    59,    59,    59,
+      59,    59,    59,    59,    60,    60,    61,    61,    63,    62,
+      64,    64,    65,    65,    66,    66,    68,    69,    67,    71,
+      70,    73,    72,    74,    74,    75,    75,    76,    76,    76,
+      77,    77,    78,    78,    79,    80,    80,    81,    81,    82,
+      82,    82,    82,    82,    82,    82,    82,    82,    82,    82,
+      82,    82,    82,    82,    82,    82,    82,    82,    82,    82,
+      82,    82,    82,    82,    82,    82,    82,    82,    82,    82
+};
+
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     0,     2,     2,     1,     1,     6,     6,
+       6,     6,     0,     9,     0,     9,     0,     9,     0,     9,
+       3,     1,     4,     2,     1,     0,     1,     1,     1,     1,
+       1,     1,     1,     1,     2,     1,     4,     7,     0,     4,
+       3,     1,     2,     4,     2,     0,     0,     0,    13,     0,
+       8,     0,    12,     3,     0,     1,     0,     3,     1,     0,
+       3,     2,     5,     5,     1,     1,     0,     3,     1,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     2,     2,     2,
+       2,     4,     3,     4,     4,     1,     4,     1,     1,     1
+};
+
+
+enum { YYENOMEM = -2 };
+
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
+
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
+
+
+#define YYRECOVERING()  (!!yyerrstatus)
+
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
+
+
+/* Enable debugging if requested.  */
+#if YYDEBUG
+
+# ifndef YYFPRINTF
+#  include <stdio.h> /* INFRINGES ON USER NAME SPACE */
+#  define YYFPRINTF fprintf
+# endif
+
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
+static void
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  if (!yyvaluep)
+    return;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
+
+static void
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
+{
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
+
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
+}
+
+/*------------------------------------------------------------------.
+| yy_stack_print -- Print the state stack from its BOTTOM up to its |
+| TOP (included).                                                   |
+`------------------------------------------------------------------*/
+
+static void
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
+{
+  YYFPRINTF (stderr, "Stack now");
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
+  YYFPRINTF (stderr, "\n");
+}
+
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
+
+
+/*------------------------------------------------.
+| Report that the YYRULE is going to be reduced.  |
+`------------------------------------------------*/
+
+static void
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
+{
+  int yylno = yyrline[yyrule];
+  int yynrhs = yyr2[yyrule];
+  int yyi;
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
+  /* The symbols being reduced.  */
+  for (yyi = 0; yyi < yynrhs; yyi++)
+    {
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
+      YYFPRINTF (stderr, "\n");
+    }
+}
+
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule); \
+} while (0)
+
+/* Nonzero means print parse trace.  It is left uninitialized so that
+   multiple parsers can coexist.  */
+int yydebug;
+#else /* !YYDEBUG */
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
+# define YY_STACK_PRINT(Bottom, Top)
+# define YY_REDUCE_PRINT(Rule)
+#endif /* !YYDEBUG */
+
+
+/* YYINITDEPTH -- initial size of the parser's stacks.  */
+#ifndef YYINITDEPTH
+# define YYINITDEPTH 200
+#endif
+
+/* YYMAXDEPTH -- maximum size the stacks can grow to (effective only
+   if the built-in stack extension method is used).
+
+   Do not make this value too large; the results are undefined if
+   YYSTACK_ALLOC_MAXIMUM < YYSTACK_BYTES (YYMAXDEPTH)
+   evaluated with infinite-precision integer arithmetic.  */
+
+#ifndef YYMAXDEPTH
+# define YYMAXDEPTH 10000
+#endif
+
+
+
+
+
+
+/*-----------------------------------------------.
+| Release the memory associated to this symbol.  |
+`-----------------------------------------------*/
+
+static void
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
+{
+  YY_USE (yyvaluep);
+  if (!yymsg)
+    yymsg = "Deleting";
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+}
+
+
+/* Lookahead token kind.  */
+int yychar;
+
+/* The semantic value of the lookahead symbol.  */
+YYSTYPE yylval;
+/* Number of syntax errors so far.  */
+int yynerrs;
+
+
+
+
+/*----------.
+| yyparse.  |
+`----------*/
+
+int
+yyparse (void)
+{
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
+
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
+
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
+
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
+
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
+
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
+  /* The variables used to return semantic value and location from the
+     action routines.  */
+  YYSTYPE yyval;
+
+
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
+  /* The number of symbols on the RHS of the reduced rule.
+     Keep to zero when no symbol should be popped.  */
+  int yylen = 0;
+
+  YYDPRINTF ((stderr, "Starting parse\n"));
+
+  yychar = YYEMPTY; /* Cause a token to be read.  */
+
+  goto yysetstate;
+
+
+/*------------------------------------------------------------.
+| yynewstate -- push a new state, which is found in yystate.  |
+`------------------------------------------------------------*/
+yynewstate:
+  /* In all cases, when you get here, the value and location stacks
+     have just been pushed.  So pushing a state here evens the stacks.  */
+  yyssp++;
+
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
+
+  if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
+    {
+      /* Get the current used size of the three stacks, in elements.  */
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
+
+# if defined yyoverflow
+      {
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
+      }
+# else /* defined YYSTACK_RELOCATE */
+      /* Extend the stack our own way.  */
+      if (YYMAXDEPTH <= yystacksize)
+        YYNOMEM;
+      yystacksize *= 2;
+      if (YYMAXDEPTH < yystacksize)
+        yystacksize = YYMAXDEPTH;
+
+      {
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
+#  undef YYSTACK_RELOCATE
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
+      }
+# endif
+
+      yyssp = yyss + yysize - 1;
+      yyvsp = yyvs + yysize - 1;
+
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
+
+      if (yyss + yystacksize - 1 <= yyssp)
+        YYABORT;
+    }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
+
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
+
+  goto yybackup;
+
+
+/*-----------.
+| yybackup.  |
+`-----------*/
+yybackup:
+  /* Do appropriate processing given the current state.  Read a
+     lookahead token if we need one and don't already have one.  */
+
+  /* First try to decide what to do without reference to lookahead token.  */
+  yyn = yypact[yystate];
+  if (yypact_value_is_default (yyn))
+    goto yydefault;
+
+  /* Not known => get a lookahead token if don't already have one.  */
+
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
+  if (yychar == YYEMPTY)
+    {
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex ();
+    }
+
+  if (yychar <= YYEOF)
+    {
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
+      YYDPRINTF ((stderr, "Now at end of input.\n"));
+    }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
+  else
+    {
+      yytoken = YYTRANSLATE (yychar);
+      YY_SYMBOL_PRINT ("Next token is", yytoken, &yylval, &yylloc);
+    }
+
+  /* If the proper action on seeing token YYTOKEN is to reduce or to
+     detect an error, take that action.  */
+  yyn += yytoken;
+  if (yyn < 0 || YYLAST < yyn || yycheck[yyn] != yytoken)
+    goto yydefault;
+  yyn = yytable[yyn];
+  if (yyn <= 0)
+    {
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
+      yyn = -yyn;
+      goto yyreduce;
+    }
+
+  /* Count tokens shifted since error; after three, turn off error
+     status.  */
+  if (yyerrstatus)
+    yyerrstatus--;
+
+  /* Shift the lookahead token.  */
+  YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
+  yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
+  goto yynewstate;
+
+
+/*-----------------------------------------------------------.
+| yydefault -- do the default action for the current state.  |
+`-----------------------------------------------------------*/
+yydefault:
+  yyn = yydefact[yystate];
+  if (yyn == 0)
+    goto yyerrlab;
+  goto yyreduce;
+
+
+/*-----------------------------.
+| yyreduce -- do a reduction.  |
+`-----------------------------*/
+yyreduce:
+  /* yyn is the number of a rule to reduce with.  */
+  yylen = yyr2[yyn];
+
+  /* If YYLEN is nonzero, implement the default value of the action:
+     '$$ = $1'.
+
+     Otherwise, the following line sets YYVAL to garbage.
+     This behavior is undocumented and Bison
+     users should not rely upon it.  Assigning to YYVAL
+     unconditionally makes the parser a bit smaller, and it avoids a
+     GCC warning that YYVAL may be used uninitialized.  */
+  yyval = yyvsp[1-yylen];
+
+
+  YY_REDUCE_PRINT (yyn);
+  switch (yyn)
+    {
+  case 5: /* body: body func_impl  */
+#line 80 "c_parser.y"
+                                    { program.addFunction((yyvsp[0].function)); }
+#line 1371 "c_parser.cpp"
+    break;
+
+  case 7: /* body: func_impl  */
+#line 82 "c_parser.y"
+                                    { program.addFunction((yyvsp[0].function)); }
+#line 1377 "c_parser.cpp"
+    break;
+
+  case 8: /* func_decl: TYPE ID LEFT_PAREN VOID RIGHT_PAREN SEMICOLON  */
+#line 85 "c_parser.y"
+                                                                                                {
+																									// We can look for functions only in global space
+																									SymbolTable* globalSymbolTable = context.globalSymbolTable();
+																									FunctionSymbol* funcSymbol;
+																									if ((funcSymbol = globalSymbolTable->addFunction(*(yyvsp[-4].strValue), Symbol::stringToDataType(*(yyvsp[-5].strValue)), {}, false)) == nullptr)
+																									{
+																										yyerror("Redeclaration of function '%s'.", (yyvsp[-4].strValue)->c_str());
+																										delete (yyvsp[-5].strValue);
+																										delete (yyvsp[-4].strValue);
+																										finalize(3);
+																										YYERROR;
+																									}
+
+																									delete (yyvsp[-5].strValue);
+																									delete (yyvsp[-4].strValue);
+																								}
+#line 1398 "c_parser.cpp"
+    break;
+
+  case 9: /* func_decl: TYPE ID LEFT_PAREN decl_param_list RIGHT_PAREN SEMICOLON  */
+#line 101 "c_parser.y"
+                                                                                                            {
+																									// We can look for functions only in global space
+																									SymbolTable* globalSymbolTable = context.globalSymbolTable();
+																									FunctionSymbol* funcSymbol;
+																									if ((funcSymbol = globalSymbolTable->addFunction(*(yyvsp[-4].strValue), Symbol::stringToDataType(*(yyvsp[-5].strValue)), *(yyvsp[-2].functionParameters), false)) == nullptr)
+																									{
+																										yyerror("Redefinition of function '%s'.", (yyvsp[-4].strValue)->c_str());
+																										delete (yyvsp[-5].strValue);
+																										delete (yyvsp[-4].strValue);
+																										delete (yyvsp[-2].functionParameters);
+																										finalize(3);
+																										YYERROR;
+																									}
+
+																									delete (yyvsp[-5].strValue);
+																									delete (yyvsp[-4].strValue);
+																									delete (yyvsp[-2].functionParameters);
+																								}
+#line 1421 "c_parser.cpp"
+    break;
+
+  case 10: /* func_decl: VOID ID LEFT_PAREN VOID RIGHT_PAREN SEMICOLON  */
+#line 119 "c_parser.y"
+                                                                                                            {
+																									// We can look for functions only in global space
+																									SymbolTable* globalSymbolTable = context.globalSymbolTable();
+																									FunctionSymbol* funcSymbol;
+																									if ((funcSymbol = globalSymbolTable->addFunction(*(yyvsp[-4].strValue), Symbol::DataType::VOID, {}, false)) == nullptr)
+																									{
+																										yyerror("Redefinition of function '%s'.", (yyvsp[-4].strValue)->c_str());
+																										delete (yyvsp[-4].strValue);
+																										finalize(3);
+																										YYERROR;
+																									}
+
+																									delete (yyvsp[-4].strValue);
+																								}
+#line 1440 "c_parser.cpp"
+    break;
+
+  case 11: /* func_decl: VOID ID LEFT_PAREN decl_param_list RIGHT_PAREN SEMICOLON  */
+#line 133 "c_parser.y"
+                                                                                                            {
+																									// We can look for functions only in global space
+																									SymbolTable* globalSymbolTable = context.globalSymbolTable();
+																									FunctionSymbol* funcSymbol;
+																									if ((funcSymbol = globalSymbolTable->addFunction(*(yyvsp[-4].strValue), Symbol::DataType::VOID, *(yyvsp[-2].functionParameters), false)) == nullptr)
+																									{
+																										yyerror("Redefinition of function '%s'.", (yyvsp[-4].strValue)->c_str());
+																										delete (yyvsp[-4].strValue);
+																										delete (yyvsp[-2].functionParameters);
+																										finalize(3);
+																										YYERROR;
+																									}
+
+																									delete (yyvsp[-4].strValue);
+																									delete (yyvsp[-2].functionParameters);
+																								}
+#line 1461 "c_parser.cpp"
+    break;
+
+  case 12: /* $@1: %empty  */
+#line 151 "c_parser.y"
+                                                                                                {
+																									context.newSymbolTable();
+
+																									// We can look for functions only in global space
+																									SymbolTable* globalSymbolTable = context.globalSymbolTable();
+																									FunctionSymbol* funcSymbol;
+																									if ((funcSymbol = globalSymbolTable->addFunction(*(yyvsp[-3].strValue), Symbol::stringToDataType(*(yyvsp[-4].strValue)), {}, true)) == nullptr)
+																									{
+																										yyerror("Redefinition of function '%s'.", (yyvsp[-3].strValue)->c_str());
+																										delete (yyvsp[-4].strValue);
+																										delete (yyvsp[-3].strValue);
+																										finalize(3);
+																										YYERROR;
+																									}
+																									context.setCurrentFunction(funcSymbol);
+																								}
+#line 1482 "c_parser.cpp"
+    break;
+
+  case 13: /* func_impl: TYPE ID LEFT_PAREN VOID RIGHT_PAREN $@1 LEFT_CBRACE stmts RIGHT_CBRACE  */
+#line 167 "c_parser.y"
+                                                                                                                                                    {
+																									(yyval.function) = new Function(context.getCurrentFunction(), (yyvsp[-1].statements));
+																									context.popSymbolTable();
+																									delete (yyvsp[-8].strValue);
+																									delete (yyvsp[-7].strValue);
+																								}
+#line 1493 "c_parser.cpp"
+    break;
+
+  case 14: /* $@2: %empty  */
+#line 173 "c_parser.y"
+                                                                                                            {
+																									context.newSymbolTable();
+
+																									// Add parameters as variables to newly created symbol table
+																									for (const auto& param : *(yyvsp[-1].functionParameters))
+																									{
+																										if (context.currentSymbolTable()->addVariable(param) == nullptr)
+																										{
+																											yyerror("Redefinition of function argument '%s'.", param->getName().c_str());
+																											delete (yyvsp[-4].strValue);
+																											delete (yyvsp[-3].strValue);
+																											delete (yyvsp[-1].functionParameters);
+																											finalize(3);
+																											YYERROR;
+																										}
+																									}
+
+																									// We can look for functions only in global space
+																									SymbolTable* globalSymbolTable = context.globalSymbolTable();
+																									FunctionSymbol* funcSymbol;
+																									if ((funcSymbol = globalSymbolTable->addFunction(*(yyvsp[-3].strValue), Symbol::stringToDataType(*(yyvsp[-4].strValue)), *(yyvsp[-1].functionParameters), true)) == nullptr)
+																									{
+																										yyerror("Redefinition of function '%s'.", (yyvsp[-3].strValue)->c_str());
+																										delete (yyvsp[-4].strValue);
+																										delete (yyvsp[-3].strValue);
+																										delete (yyvsp[-1].functionParameters);
+																										finalize(3);
+																										YYERROR;
+																									}
+																									context.setCurrentFunction(funcSymbol);
+																								}
+#line 1529 "c_parser.cpp"
+    break;
+
+  case 15: /* func_impl: TYPE ID LEFT_PAREN impl_param_list RIGHT_PAREN $@2 LEFT_CBRACE stmts RIGHT_CBRACE  */
+#line 204 "c_parser.y"
+                                                                                                                                                                {
+																									(yyval.function) = new Function(context.getCurrentFunction(), (yyvsp[-1].statements));
+																									context.popSymbolTable();
+																									delete (yyvsp[-8].strValue);
+																									delete (yyvsp[-7].strValue);
+																									delete (yyvsp[-5].functionParameters);
+																								}
+#line 1541 "c_parser.cpp"
+    break;
+
+  case 16: /* $@3: %empty  */
+#line 211 "c_parser.y"
+                                                                                                            {
+																									context.newSymbolTable();
+
+																									// We can look for functions only in global space
+																									SymbolTable* globalSymbolTable = context.globalSymbolTable();
+																									FunctionSymbol* funcSymbol;
+																									if ((funcSymbol = globalSymbolTable->addFunction(*(yyvsp[-3].strValue), Symbol::DataType::VOID, {}, true)) == nullptr)
+																									{
+																										yyerror("Redefinition of function '%s'.", (yyvsp[-3].strValue)->c_str());
+																										delete (yyvsp[-3].strValue);
+																										finalize(3);
+																										YYERROR;
+																									}
+																									context.setCurrentFunction(funcSymbol);
+																								}
+#line 1561 "c_parser.cpp"
+    break;
+
+  case 17: /* func_impl: VOID ID LEFT_PAREN VOID RIGHT_PAREN $@3 LEFT_CBRACE stmts RIGHT_CBRACE  */
+#line 226 "c_parser.y"
+                                                                                                                                                    {
+																									(yyval.function) = new Function(context.getCurrentFunction(), (yyvsp[-1].statements));
+																									context.popSymbolTable();
+																									delete (yyvsp[-7].strValue);
+																								}
+#line 1571 "c_parser.cpp"
+    break;
+
+  case 18: /* $@4: %empty  */
+#line 231 "c_parser.y"
+                                                                                                            {
+																									context.newSymbolTable();
+
+																									// Add parameters as variables to newly created symbol table
+																									for (const auto& param : *(yyvsp[-1].functionParameters))
+																									{
+																										if (context.currentSymbolTable()->addVariable(param) == nullptr)
+																										{
+																											yyerror("Redefinition of function argument '%s'.", param->getName().c_str());
+																											delete (yyvsp[-3].strValue);
+																											delete (yyvsp[-1].functionParameters);
+																											finalize(3);
+																											YYERROR;
+																										}
+																									}
+
+																									// We can look for functions only in global space
+																									SymbolTable* globalSymbolTable = context.globalSymbolTable();
+																									FunctionSymbol* funcSymbol;
+																									if ((funcSymbol = globalSymbolTable->addFunction(*(yyvsp[-3].strValue), Symbol::DataType::VOID, *(yyvsp[-1].functionParameters), true)) == nullptr)
+																									{
+																										yyerror("Redefinition of function '%s'.", (yyvsp[-3].strValue)->c_str());
+																										delete (yyvsp[-3].strValue);
+																										delete (yyvsp[-1].functionParameters);
+																										finalize(3);
+																										YYERROR;
+																									}
+																									context.setCurrentFunction(funcSymbol);
+																								}
+#line 1605 "c_parser.cpp"
+    break;
+
+  case 19: /* func_impl: VOID ID LEFT_PAREN impl_param_list RIGHT_PAREN $@4 LEFT_CBRACE stmts RIGHT_CBRACE  */
+#line 260 "c_parser.y"
+                                                                                                                                                            {
+																									(yyval.function) = new Function(context.getCurrentFunction(), (yyvsp[-1].statements));
+																									context.popSymbolTable();
+																									delete (yyvsp[-7].strValue);
+																									delete (yyvsp[-5].functionParameters);
+																								}
+#line 1616 "c_parser.cpp"
+    break;
+
+  case 20: /* decl_param_list: decl_param_list COMMA TYPE  */
+#line 268 "c_parser.y"
+                                                    { (yyval.functionParameters)->push_back(new VariableSymbol("", Symbol::stringToDataType({*(yyvsp[0].strValue)}))); delete (yyvsp[0].strValue); }
+#line 1622 "c_parser.cpp"
+    break;
+
+  case 21: /* decl_param_list: TYPE  */
+#line 269 "c_parser.y"
+                                                                    { (yyval.functionParameters) = new FunctionSymbol::ParameterList( { new VariableSymbol("", Symbol::stringToDataType({*(yyvsp[0].strValue)})) } ); delete (yyvsp[0].strValue); }
+#line 1628 "c_parser.cpp"
+    break;
+
+  case 22: /* impl_param_list: impl_param_list COMMA TYPE ID  */
+#line 272 "c_parser.y"
+                                                    { (yyval.functionParameters)->push_back(new VariableSymbol(*(yyvsp[0].strValue), Symbol::stringToDataType({*(yyvsp[-1].strValue)}))); delete (yyvsp[-1].strValue); delete (yyvsp[0].strValue); }
+#line 1634 "c_parser.cpp"
+    break;
+
+  case 23: /* impl_param_list: TYPE ID  */
+#line 273 "c_parser.y"
+                                                                    { (yyval.functionParameters) = new FunctionSymbol::ParameterList( { new VariableSymbol(*(yyvsp[0].strValue), Symbol::stringToDataType({*(yyvsp[-1].strValue)})) } ); delete (yyvsp[-1].strValue); delete (yyvsp[0].strValue); }
+#line 1640 "c_parser.cpp"
+    break;
+
+  case 24: /* stmts: stmt_list  */
+#line 276 "c_parser.y"
+                        { (yyval.statements) = (yyvsp[0].statements); }
+#line 1646 "c_parser.cpp"
+    break;
+
+  case 25: /* stmts: %empty  */
+#line 277 "c_parser.y"
+                                { (yyval.statements) = new StatementBlock(); }
+#line 1652 "c_parser.cpp"
+    break;
+
+  case 26: /* stmt: assign_stmt  */
+#line 280 "c_parser.y"
+                        { (yyval.statement) = (yyvsp[0].statement); }
+#line 1658 "c_parser.cpp"
+    break;
+
+  case 27: /* stmt: decl_stmt  */
+#line 281 "c_parser.y"
+                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 1664 "c_parser.cpp"
+    break;
+
+  case 28: /* stmt: if_stmt  */
+#line 282 "c_parser.y"
+                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 1670 "c_parser.cpp"
+    break;
+
+  case 29: /* stmt: while_stmt  */
+#line 283 "c_parser.y"
+                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 1676 "c_parser.cpp"
+    break;
+
+  case 30: /* stmt: for_stmt  */
+#line 284 "c_parser.y"
+                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 1682 "c_parser.cpp"
+    break;
+
+  case 31: /* stmt: return_stmt  */
+#line 285 "c_parser.y"
+                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 1688 "c_parser.cpp"
+    break;
+
+  case 32: /* stmt: call_stmt  */
+#line 286 "c_parser.y"
+                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 1694 "c_parser.cpp"
+    break;
+
+  case 33: /* stmt: empty_stmt  */
+#line 287 "c_parser.y"
+                                { (yyval.statement) = (yyvsp[0].statement); }
+#line 1700 "c_parser.cpp"
+    break;
+
+  case 34: /* stmt_list: stmt_list stmt  */
+#line 290 "c_parser.y"
+                                            {
+												// Do not add empty statements
+												if ((yyvsp[0].statement) != nullptr)
+													(yyval.statements)->addStatement((yyvsp[0].statement));
+											}
+#line 1710 "c_parser.cpp"
+    break;
+
+  case 35: /* stmt_list: stmt  */
+#line 295 "c_parser.y"
+                                                        {
+												// Check whether it is an empty statement, if so, create just empty statement list
+												(yyval.statements) = new StatementBlock();
+												if ((yyvsp[0].statement) != nullptr)
+													(yyval.statements)->addStatement((yyvsp[0].statement));
+											}
+#line 1721 "c_parser.cpp"
+    break;
+
+  case 36: /* assign_stmt: ID ASSIGN expr SEMICOLON  */
+#line 303 "c_parser.y"
+                                            {
+												Symbol* symbol = context.findSymbol(*(yyvsp[-3].strValue));
+												if (symbol == nullptr || symbol->getType() != Symbol::Type::VARIABLE)
+												{
+													yyerror("Assignment to undefined symbol '%s'.", (yyvsp[-3].strValue)->c_str());
+													delete (yyvsp[-3].strValue);
+													finalize(3);
+													YYERROR;
+												}
+
+												VariableSymbol* varSymbol = static_cast<VariableSymbol*>(symbol);
+												if (varSymbol->isArray())
+												{
+													yyerror("Unable to assign to array '%s'.", varSymbol->getName().c_str());
+													delete (yyvsp[-3].strValue);
+													finalize(3);
+													YYERROR;
+												}
+
+												if (varSymbol->getDataType() != (yyvsp[-1].expression)->getDataType())
+												{
+													yyerror("Unable to assign '%s' to variable '%s' of type '%s'.",
+																Symbol::dataTypeToString((yyvsp[-1].expression)->getDataType()).c_str(),
+																varSymbol->getName().c_str(),
+																Symbol::dataTypeToString(varSymbol->getDataType()).c_str());
+													delete (yyvsp[-3].strValue);
+													finalize(3);
+													YYERROR;
+												}
+
+												(yyval.statement) = new AssignStatement(varSymbol, (yyvsp[-1].expression));
+												delete (yyvsp[-3].strValue);
+											}
+#line 1759 "c_parser.cpp"
+    break;
+
+  case 37: /* assign_stmt: ID LEFT_BRACKET expr RIGHT_BRACKET ASSIGN expr SEMICOLON  */
+#line 336 "c_parser.y"
+                                                                                        {
+												Symbol* symbol = context.findSymbol(*(yyvsp[-6].strValue));
+												if (symbol == nullptr || symbol->getType() != Symbol::Type::VARIABLE)
+												{
+													yyerror("Assignment to undefined symbol '%s'.", (yyvsp[-6].strValue)->c_str());
+													delete (yyvsp[-6].strValue);
+													finalize(3);
+													YYERROR;
+												}
+
+												VariableSymbol* varSymbol = static_cast<VariableSymbol*>(symbol);
+												if (!varSymbol->isArray())
+												{
+													yyerror("Variable '%s' is not an array.", varSymbol->getName().c_str());
+													delete (yyvsp[-6].strValue);
+													finalize(3);
+													YYERROR;
+												}
+
+												if ((yyvsp[-4].expression)->getDataType() != Symbol::DataType::INT)
+												{
+													yyerror("Array index is of type '%s'. Must be 'int'.",
+																Symbol::dataTypeToString((yyvsp[-4].expression)->getDataType()).c_str());
+													delete (yyvsp[-6].strValue);
+													finalize(3);
+													YYERROR;
+												}
+
+												if (varSymbol->getDataType() != (yyvsp[-1].expression)->getDataType())
+												{
+													yyerror("Unable to assign '%s' to element of array '%s' of type '%s'.",
+																Symbol::dataTypeToString((yyvsp[-1].expression)->getDataType()).c_str(),
+																varSymbol->getName().c_str(),
+																Symbol::dataTypeToString(varSymbol->getDataType()).c_str());
+													delete (yyvsp[-6].strValue);
+													finalize(3);
+													YYERROR;
+												}
+
+												(yyval.statement) = new ArrayElementAssignStatement(varSymbol, (yyvsp[-4].expression), (yyvsp[-1].expression));
+												delete (yyvsp[-6].strValue);
+											}
+#line 1806 "c_parser.cpp"
+    break;
+
+  case 38: /* $@5: %empty  */
+#line 380 "c_parser.y"
+                                                { context.setCurrentDeclaredVarType(Symbol::stringToDataType(*(yyvsp[0].strValue))); }
+#line 1812 "c_parser.cpp"
+    break;
+
+  case 39: /* decl_stmt: TYPE $@5 decl_id_list SEMICOLON  */
+#line 381 "c_parser.y"
+                                                                        {
+												(yyval.statement) = new DeclarationStatement(*(yyvsp[-1].declList));
+												delete (yyvsp[-3].strValue);
+												delete (yyvsp[-1].declList);
+											}
+#line 1822 "c_parser.cpp"
+    break;
+
+  case 40: /* decl_id_list: decl_id_list COMMA decl_id  */
+#line 388 "c_parser.y"
+                                                    { (yyval.declList)->push_back((yyvsp[0].declaration)); }
+#line 1828 "c_parser.cpp"
+    break;
+
+  case 41: /* decl_id_list: decl_id  */
+#line 389 "c_parser.y"
+                                                                    { (yyval.declList) = new std::vector<Declaration*>( { (yyvsp[0].declaration) } ); }
+#line 1834 "c_parser.cpp"
+    break;
+
+  case 42: /* decl_id: ID decl_init_expr  */
+#line 392 "c_parser.y"
+                                                    {
+														Symbol* symbol = nullptr;
+														if ((symbol = context.findSymbol(*(yyvsp[-1].strValue))) != nullptr)
+														{
+															// We cannot shadow functions
+															if (symbol->getType() != Symbol::Type::VARIABLE)
+															{
+																yyerror("Redefinition of symbol '%s'. Cannot shadow functions.", symbol->getName().c_str());
+																delete (yyvsp[-1].strValue);
+																delete (yyvsp[0].expression);
+																finalize(3);
+																YYERROR;
+															}
+														}
+
+														// Adding can fail if there is symbol in the same block, we cannot shadow in the same block
+														if ((symbol = context.currentSymbolTable()->addVariable(*(yyvsp[-1].strValue), context.getCurrentDeclaredVarType())) == nullptr)
+														{
+															yyerror("Redefinition of symbol '%s'.", (yyvsp[-1].strValue)->c_str());
+															delete (yyvsp[-1].strValue);
+															delete (yyvsp[0].expression);
+															finalize(3);
+															YYERROR;
+														}
+
+														VariableSymbol* varSymbol = static_cast<VariableSymbol*>(symbol);
+														if ((yyvsp[0].expression) && (yyvsp[0].expression)->getDataType() != varSymbol->getDataType())
+														{
+															yyerror("Unable to initialize variable '%s' of type '%s' with '%s'.",
+																		varSymbol->getName().c_str(),
+																		Symbol::dataTypeToString(varSymbol->getDataType()).c_str(),
+																		Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+															delete (yyvsp[-1].strValue);
+															delete (yyvsp[0].expression);
+															finalize(3);
+															YYERROR;
+														}
+
+														(yyval.declaration) = new Declaration(varSymbol, (yyvsp[0].expression));
+														delete (yyvsp[-1].strValue);
+													}
+#line 1880 "c_parser.cpp"
+    break;
+
+  case 43: /* decl_id: ID LEFT_BRACKET INT_LIT RIGHT_BRACKET  */
+#line 433 "c_parser.y"
+                                                                            {
+														Symbol* symbol = nullptr;
+														if ((symbol = context.findSymbol(*(yyvsp[-3].strValue))) != nullptr)
+														{
+															// We cannot shadow functions
+															if (symbol->getType() != Symbol::Type::VARIABLE)
+															{
+																yyerror("Redefinition of symbol '%s'. Cannot shadow functions.", symbol->getName().c_str());
+																delete (yyvsp[-3].strValue);
+																finalize(3);
+																YYERROR;
+															}
+														}
+
+														// Only characters and integers have fixed size
+														Symbol::DataType dataType = context.getCurrentDeclaredVarType();
+														if (dataType != Symbol::DataType::INT && dataType != Symbol::DataType::CHAR)
+														{
+															yyerror("Unable to declare array '%s' of type '%s'.", (yyvsp[-3].strValue)->c_str(), Symbol::dataTypeToString(dataType).c_str());
+															delete (yyvsp[-3].strValue);
+															finalize(3);
+															YYERROR;
+														}
+
+														if ((yyvsp[-1].intValue) <= 0)
+														{
+															yyerror("Array '%s' must have at least one element.", (yyvsp[-3].strValue)->c_str());
+															delete (yyvsp[-3].strValue);
+															finalize(3);
+															YYERROR;
+														}
+
+														if (!context.reserveArrayBytes((yyvsp[-1].intValue), dataType == Symbol::DataType::INT ? 4 : 1))
+														{
+															yyerror("Array '%s' does not fit on the stack.", (yyvsp[-3].strValue)->c_str());
+															delete (yyvsp[-3].strValue);
+															finalize(3);
+															YYERROR;
+														}
+
+														// Adding can fail if there is symbol in the same block, we cannot shadow in the same block
+														if ((symbol = context.currentSymbolTable()->addVariable(*(yyvsp[-3].strValue), dataType, (yyvsp[-1].intValue))) == nullptr)
+														{
+															yyerror("Redefinition of symbol '%s'.", (yyvsp[-3].strValue)->c_str());
+															delete (yyvsp[-3].strValue);
+															finalize(3);
+															YYERROR;
+														}
+
+														(yyval.declaration) = new Declaration(static_cast<VariableSymbol*>(symbol), nullptr);
+														delete (yyvsp[-3].strValue);
+													}
+#line 1937 "c_parser.cpp"
+    break;
+
+  case 44: /* decl_init_expr: ASSIGN expr  */
+#line 487 "c_parser.y"
+                                                    { (yyval.expression) = (yyvsp[0].expression); }
+#line 1943 "c_parser.cpp"
+    break;
+
+  case 45: /* decl_init_expr: %empty  */
+#line 488 "c_parser.y"
+                                                                    { (yyval.expression) = nullptr; }
+#line 1949 "c_parser.cpp"
+    break;
+
+  case 46: /* $@6: %empty  */
+#line 491 "c_parser.y"
+                                                    {
+														if ((yyvsp[-1].expression)->getDataType() != Symbol::DataType::INT)
+														{
+															yyerror("Condition of if statement is of type '%s'. Must be 'int'.",
+																Symbol::dataTypeToString((yyvsp[-1].expression)->getDataType()).c_str());
+															finalize(3);
+															YYERROR;
+														}
+
+														context.newSymbolTable();
+													}
+#line 1965 "c_parser.cpp"
+    break;
+
+  case 47: /* $@7: %empty  */
+#line 502 "c_parser.y"
+                                                                    {
+														context.popSymbolTable();
+														context.newSymbolTable();
+													}
+#line 1974 "c_parser.cpp"
+    break;
+
+  case 48: /* if_stmt: IF LEFT_PAREN expr RIGHT_PAREN $@6 LEFT_CBRACE stmts RIGHT_CBRACE ELSE $@7 LEFT_CBRACE stmts RIGHT_CBRACE  */
+#line 506 "c_parser.y"
+                                                                    {
+														(yyval.statement) = new IfStatement((yyvsp[-10].expression), (yyvsp[-6].statements), (yyvsp[-1].statements));
+														context.popSymbolTable();
+													}
+#line 1983 "c_parser.cpp"
+    break;
+
+  case 49: /* $@8: %empty  */
+#line 513 "c_parser.y"
+                                                    {
+														if ((yyvsp[-1].expression)->getDataType() != Symbol::DataType::INT)
+														{
+															yyerror("Condition of while statement is of type '%s'. Must be 'int'.",
+																Symbol::dataTypeToString((yyvsp[-1].expression)->getDataType()).c_str());
+															finalize(3);
+															YYERROR;
+														}
+
+														context.newSymbolTable();
+													}
+#line 1999 "c_parser.cpp"
+    break;
+
+  case 50: /* while_stmt: WHILE LEFT_PAREN expr RIGHT_PAREN $@8 LEFT_CBRACE stmts RIGHT_CBRACE  */
+#line 524 "c_parser.y"
+                                                                        {
+														(yyval.statement) = new WhileStatement((yyvsp[-5].expression), (yyvsp[-1].statements));
+														context.popSymbolTable();
+													}
+#line 2008 "c_parser.cpp"
+    break;
+
+  case 51: /* $@9: %empty  */
+#line 531 "c_parser.y"
+                                                                                                        {
+														if ((yyvsp[-3].expression) && (yyvsp[-3].expression)->getDataType() != Symbol::DataType::INT)
+														{
+															yyerror("Condition of for statement is of type '%s'. Must be 'int'.",
+																Symbol::dataTypeToString((yyvsp[-3].expression)->getDataType()).c_str());
+															finalize(3);
+															YYERROR;
+														}
+
+														context.newSymbolTable();
+													}
+#line 2024 "c_parser.cpp"
+    break;
+
+  case 52: /* for_stmt: FOR LEFT_PAREN for_init SEMICOLON for_cond SEMICOLON for_iter RIGHT_PAREN $@9 LEFT_CBRACE stmts RIGHT_CBRACE  */
+#line 542 "c_parser.y"
+                                                                        {
+														(yyval.statement) = new ForStatement((yyvsp[-9].forInitStmt), (yyvsp[-7].expression), (yyvsp[-5].forIterStmt), (yyvsp[-1].statements));
+														context.popSymbolTable();
+													}
+#line 2033 "c_parser.cpp"
+    break;
+
+  case 53: /* for_init: ID ASSIGN expr  */
+#line 548 "c_parser.y"
+                                                    {
+														Symbol* symbol = context.findSymbol(*(yyvsp[-2].strValue));
+														if (symbol == nullptr || symbol->getType() != Symbol::Type::VARIABLE)
+														{
+															yyerror("Assignment to undefined symbol '%s'.", (yyvsp[-2].strValue)->c_str());
+															delete (yyvsp[-2].strValue);
+															finalize(3);
+															YYERROR;
+														}
+
+														VariableSymbol* varSymbol = static_cast<VariableSymbol*>(symbol);
+														if (varSymbol->isArray())
+														{
+															yyerror("Unable to assign to array '%s'.", varSymbol->getName().c_str());
+															delete (yyvsp[-2].strValue);
+															finalize(3);
+															YYERROR;
+														}
+
+														if (varSymbol->getDataType() != (yyvsp[0].expression)->getDataType())
+														{
+															yyerror("Unable to assign '%s' to variable '%s' of type '%s'.",
+																		Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str(),
+																		varSymbol->getName().c_str(),
+																		Symbol::dataTypeToString(varSymbol->getDataType()).c_str());
+															delete (yyvsp[-2].strValue);
+															finalize(3);
+															YYERROR;
+														}
+
+														(yyval.forInitStmt) = new AssignStatement(varSymbol, (yyvsp[0].expression));
+														delete (yyvsp[-2].strValue);
+													}
+#line 2071 "c_parser.cpp"
+    break;
+
+  case 54: /* for_init: %empty  */
+#line 581 "c_parser.y"
+                                                                { (yyval.forInitStmt) = nullptr; }
+#line 2077 "c_parser.cpp"
+    break;
+
+  case 55: /* for_cond: expr  */
+#line 584 "c_parser.y"
+                                                    { (yyval.expression) = (yyvsp[0].expression); }
+#line 2083 "c_parser.cpp"
+    break;
+
+  case 56: /* for_cond: %empty  */
+#line 585 "c_parser.y"
+                                                                { (yyval.expression) = nullptr; }
+#line 2089 "c_parser.cpp"
+    break;
+
+  case 57: /* for_iter: ID ASSIGN expr  */
+#line 588 "c_parser.y"
+                                                    {
+														Symbol* symbol = context.findSymbol(*(yyvsp[-2].strValue));
+														if (symbol == nullptr || symbol->getType() != Symbol::Type::VARIABLE)
+														{
+															yyerror("Assignment to undefined symbol '%s'.", (yyvsp[-2].strValue)->c_str());
+															delete (yyvsp[-2].strValue);
+															finalize(3);
+															YYERROR;
+														}
+
+														VariableSymbol* varSymbol = static_cast<VariableSymbol*>(symbol);
+														if (varSymbol->isArray())
+														{
+															yyerror("Unable to assign to array '%s'.", varSymbol->getName().c_str());
+															delete (yyvsp[-2].strValue);
+															finalize(3);
+															YYERROR;
+														}
+
+														if (varSymbol->getDataType() != (yyvsp[0].expression)->getDataType())
+														{
+															yyerror("Unable to assign '%s' to variable '%s' of type '%s'.",
+																		Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str(),
+																		varSymbol->getName().c_str(),
+																		Symbol::dataTypeToString(varSymbol->getDataType()).c_str());
+															delete (yyvsp[-2].strValue);
+															finalize(3);
+															YYERROR;
+														}
+
+														(yyval.forIterStmt) = new ForIterationStatement(new AssignStatement(varSymbol, (yyvsp[0].expression)));
+														delete (yyvsp[-2].strValue);
+													}
+#line 2127 "c_parser.cpp"
+    break;
+
+  case 58: /* for_iter: expr  */
+#line 621 "c_parser.y"
+                                                                { (yyval.forIterStmt) = new ForIterationStatement((yyvsp[0].expression)); }
+#line 2133 "c_parser.cpp"
+    break;
+
+  case 59: /* for_iter: %empty  */
+#line 622 "c_parser.y"
+                                                                { (yyval.forIterStmt) = nullptr; }
+#line 2139 "c_parser.cpp"
+    break;
+
+  case 60: /* return_stmt: RETURN expr SEMICOLON  */
+#line 625 "c_parser.y"
+                                        {
+											if (context.getCurrentFunction()->getReturnType() != (yyvsp[-1].expression)->getDataType())
+											{
+												yyerror("Return type mismatch. Expected '%s', got '%s'.",
+													Symbol::dataTypeToString(context.getCurrentFunction()->getReturnType()).c_str(),
+													Symbol::dataTypeToString((yyvsp[-1].expression)->getDataType()).c_str());
+												finalize(3);
+												YYERROR;
+											}
+
+											(yyval.statement) = new ReturnStatement((yyvsp[-1].expression));
+										}
+#line 2156 "c_parser.cpp"
+    break;
+
+  case 61: /* return_stmt: RETURN SEMICOLON  */
+#line 637 "c_parser.y"
+                                                        {
+											if (context.getCurrentFunction()->getReturnType() != Symbol::DataType::VOID)
+											{
+												yyerror("Return type mismatch. Expected '%s', got 'void'.",
+													Symbol::dataTypeToString(context.getCurrentFunction()->getReturnType()).c_str());
+												finalize(3);
+												YYERROR;
+											}
+
+											(yyval.statement) = new ReturnStatement();
+										}
+#line 2172 "c_parser.cpp"
+    break;
+
+  case 62: /* call_stmt: ID LEFT_PAREN exprs RIGHT_PAREN SEMICOLON  */
+#line 650 "c_parser.y"
+                                                            {
+																std::vector<Symbol::DataType> paramDataTypes;
+																std::for_each((yyvsp[-2].expressions)->begin(), (yyvsp[-2].expressions)->end(), [&paramDataTypes](Expression* expr) { paramDataTypes.push_back(expr->getDataType()); });
+																std::string mangledName = NameMangler::mangle(*(yyvsp[-4].strValue), paramDataTypes);
+
+																// We can look for functions only in global space
+																Symbol* symbol = nullptr;
+																if ((symbol = context.globalSymbolTable()->findSymbol(mangledName)) == nullptr)
+																{
+																	yyerror("Undeclared identifier '%s' used.", (yyvsp[-4].strValue)->c_str());
+																	delete (yyvsp[-4].strValue);
+																	delete (yyvsp[-2].expressions);
+																	finalize(3);
+																	YYERROR;
+																}
+
+																// Symbol needs to represent function
+																if (symbol->getType() != Symbol::Type::FUNCTION)
+																{
+																	yyerror("Identifier '%s' is not a function.", (yyvsp[-4].strValue)->c_str());
+																	delete (yyvsp[-4].strValue);
+																	delete (yyvsp[-2].expressions);
+																	finalize(3);
+																	YYERROR;
+																}
+
+																// Check whether number of parameters match
+																FunctionSymbol* func = static_cast<FunctionSymbol*>(symbol);
+																if (func->getParameters().size() != (yyvsp[-2].expressions)->size())
+																{
+																	yyerror("Unexpected amount of arguments provided when calling '%s'. Expected %u, got %u.",
+																		(yyvsp[-4].strValue)->c_str(), func->getParameters().size(), (yyvsp[-2].expressions)->size());
+																	delete (yyvsp[-4].strValue);
+																	delete (yyvsp[-2].expressions);
+																	finalize(3);
+																	YYERROR;
+																}
+
+																const FunctionSymbol::ParameterList& paramList = func->getParameters();
+																for (uint32_t i = 0; i < paramList.size(); ++i)
+																{
+																	if (paramList[i]->getDataType() != (yyvsp[-2].expressions)->at(i)->getDataType())
+																	{
+																		yyerror("Type mismatch for parameter on position %u in call of function '%s'. Expected %s, got %s.",
+																				i, (yyvsp[-4].strValue)->c_str(),
+																				Symbol::dataTypeToString((yyvsp[-2].expressions)->at(i)->getDataType()).c_str(),
+																				Symbol::dataTypeToString(paramList[i]->getDataType()).c_str());
+																		delete (yyvsp[-4].strValue);
+																		delete (yyvsp[-2].expressions);
+																		finalize(3);
+																		YYERROR;
+																	}
+																}
+
+																(yyval.statement) = new CallStatement(func, *(yyvsp[-2].expressions));
+																delete (yyvsp[-4].strValue);
+																delete (yyvsp[-2].expressions);
+															}
+#line 2235 "c_parser.cpp"
+    break;
+
+  case 63: /* call_stmt: BUILTIN LEFT_PAREN exprs RIGHT_PAREN SEMICOLON  */
+#line 708 "c_parser.y"
+                                                                           {
+																if (*(yyvsp[-4].strValue) == "print")
+																{
+																	if ((yyvsp[-2].expressions)->size() < 1)
+																	{
+																		yyerror("Builtin function 'print' requires at least 1 argument.");
+																		delete (yyvsp[-4].strValue);
+																		delete (yyvsp[-2].expressions);
+																		finalize(3);
+																		YYERROR;
+																	}
+
+																}
+																else if (*(yyvsp[-4].strValue) == "read_char")
+																{
+																	if ((yyvsp[-2].expressions)->size() != 0)
+																	{
+																		yyerror("Builtin function 'read_char' requires 0 arguments.");
+																		delete (yyvsp[-4].strValue);
+																		delete (yyvsp[-2].expressions);
+																		finalize(3);
+																		YYERROR;
+																	}
+																}
+																else if (*(yyvsp[-4].strValue) == "read_int")
+																{
+																	if ((yyvsp[-2].expressions)->size() != 0)
+																	{
+																		yyerror("Builtin function 'read_int' requires 0 arguments.");
+																		delete (yyvsp[-4].strValue);
+																		delete (yyvsp[-2].expressions);
+																		finalize(3);
+																		YYERROR;
+																	}
+																}
+																else if (*(yyvsp[-4].strValue) == "read_string")
+																{
+																	if ((yyvsp[-2].expressions)->size() != 0)
+																	{
+																		yyerror("Builtin function 'read_string' requires 0 arguments.");
+																		delete (yyvsp[-4].strValue);
+																		delete (yyvsp[-2].expressions);
+																		finalize(3);
+																		YYERROR;
+																	}
+																}
+																else if (*(yyvsp[-4].strValue) == "get_at")
+																{
+																	if ((yyvsp[-2].expressions)->size() != 2)
+																	{
+																		yyerror("Builtin function 'get_at' requires 2 arguments.");
+																		delete (yyvsp[-4].strValue);
+																		delete (yyvsp[-2].expressions);
+																		finalize(3);
+																		YYERROR;
+																	}
+
+																	if (((yyvsp[-2].expressions)->at(0)->getDataType() != Symbol::DataType::STRING) || ((yyvsp[-2].expressions)->at(1)->getDataType() != Symbol::DataType::INT))
+																	{
+																		yyerror("Function 'get_at' requires its arguments type to be (string, int). Got (%s, %s).",
+																			Symbol::dataTypeToString((yyvsp[-2].expressions)->at(0)->getDataType()).c_str(),
+																			Symbol::dataTypeToString((yyvsp[-2].expressions)->at(1)->getDataType()).c_str());
+																		delete (yyvsp[-4].strValue);
+																		delete (yyvsp[-2].expressions);
+																		finalize(3);
+																		YYERROR;
+																	}
+																}
+																else if (*(yyvsp[-4].strValue) == "set_at")
+																{
+																	if ((yyvsp[-2].expressions)->size() != 3)
+																	{
+																		yyerror("Builtin function 'set_at' requires 3 arguments.");
+																		delete (yyvsp[-4].strValue);
+																		delete (yyvsp[-2].expressions);
+																		finalize(3);
+																		YYERROR;
+																	}
+
+																	if (((yyvsp[-2].expressions)->at(0)->getDataType() != Symbol::DataType::STRING) || ((yyvsp[-2].expressions)->at(1)->getDataType() != Symbol::DataType::INT)
+																		|| ((yyvsp[-2].expressions)->at(2)->getDataType() != Symbol::DataType::CHAR))
+																	{
+																		yyerror("Function 'set_at' requires its arguments type to be (string, int, char). Got (%s, %s, %s).",
+																			Symbol::dataTypeToString((yyvsp[-2].expressions)->at(0)->getDataType()).c_str(),
+																			Symbol::dataTypeToString((yyvsp[-2].expressions)->at(1)->getDataType()).c_str(),
+																			Symbol::dataTypeToString((yyvsp[-2].expressions)->at(2)->getDataType()).c_str());
+																		delete (yyvsp[-4].strValue);
+																		delete (yyvsp[-2].expressions);
+																		finalize(3);
+																		YYERROR;
+																	}
+																}
+																else if (*(yyvsp[-4].strValue) == "strcat")
+																{
+																	if ((yyvsp[-2].expressions)->size() != 2)
+																	{
+																		yyerror("Builtin function 'strcat' requires 2 arguments.");
+																		delete (yyvsp[-4].strValue);
+																		delete (yyvsp[-2].expressions);
+																		finalize(3);
+																		YYERROR;
+																	}
+
+																	if (((yyvsp[-2].expressions)->at(0)->getDataType() != Symbol::DataType::STRING) || ((yyvsp[-2].expressions)->at(1)->getDataType() != Symbol::DataType::STRING))
+																	{
+																		yyerror("Function 'strcat' requires its arguments type to be (string, string). Got (%s, %s).",
+																			Symbol::dataTypeToString((yyvsp[-2].expressions)->at(0)->getDataType()).c_str(),
+																			Symbol::dataTypeToString((yyvsp[-2].expressions)->at(1)->getDataType()).c_str());
+																		delete (yyvsp[-4].strValue);
+																		delete (yyvsp[-2].expressions);
+																		finalize(3);
+																		YYERROR;
+																	}
+																}
+																else if (*(yyvsp[-4].strValue) == "strlen")
+																{
+																	if ((yyvsp[-2].expressions)->size() != 1)
+																	{
+																		yyerror("Builtin function 'strlen' requires 1 argument.");
+																		delete (yyvsp[-4].strValue);
+																		delete (yyvsp[-2].expressions);
+																		finalize(3);
+																		YYERROR;
+																	}
+
+																	if ((yyvsp[-2].expressions)->at(0)->getDataType() != Symbol::DataType::STRING)
+																	{
+																		yyerror("Function 'strlen' requires its arguments type to be (string). Got (%s).",
+																			Symbol::dataTypeToString((yyvsp[-2].expressions)->at(0)->getDataType()).c_str());
+																		delete (yyvsp[-4].strValue);
+																		delete (yyvsp[-2].expressions);
+																		finalize(3);
+																		YYERROR;
+																	}
+																}
+																else if (*(yyvsp[-4].strValue) == "substr")
+																{
+																	if ((yyvsp[-2].expressions)->size() != 3)
+																	{
+																		yyerror("Builtin function 'substr' requires 3 arguments.");
+																		delete (yyvsp[-4].strValue);
+																		delete (yyvsp[-2].expressions);
+																		finalize(3);
+																		YYERROR;
+																	}
+
+																	if (((yyvsp[-2].expressions)->at(0)->getDataType() != Symbol::DataType::STRING) || ((yyvsp[-2].expressions)->at(1)->getDataType() != Symbol::DataType::INT)
+																		|| ((yyvsp[-2].expressions)->at(2)->getDataType() != Symbol::DataType::INT))
+																	{
+																		yyerror("Function 'substr' requires its arguments type to be (string, int, int). Got (%s, %s, %s).",
+																			Symbol::dataTypeToString((yyvsp[-2].expressions)->at(0)->getDataType()).c_str(),
+																			Symbol::dataTypeToString((yyvsp[-2].expressions)->at(1)->getDataType()).c_str(),
+																			Symbol::dataTypeToString((yyvsp[-2].expressions)->at(2)->getDataType()).c_str());
+																		delete (yyvsp[-4].strValue);
+																		delete (yyvsp[-2].expressions);
+																		finalize(3);
+																		YYERROR;
+																	}
+																}
+																else
+																{
+																	yyerror("Builtin function '%s' cannot be in form of statement.", (yyvsp[-4].strValue)->c_str());
+																	delete (yyvsp[-4].strValue);
+																	finalize(3);
+																	YYERROR;
+																}
+
+																(yyval.statement) = new BuiltinCallStatement(*(yyvsp[-4].strValue), *(yyvsp[-2].expressions));
+																delete (yyvsp[-4].strValue);
+																delete (yyvsp[-2].expressions);
+															}
+#line 2411 "c_parser.cpp"
+    break;
+
+  case 64: /* empty_stmt: SEMICOLON  */
+#line 881 "c_parser.y"
+                          { (yyval.statement) = nullptr; }
+#line 2417 "c_parser.cpp"
+    break;
+
+  case 65: /* exprs: expr_list  */
+#line 884 "c_parser.y"
+                          { (yyval.expressions) = (yyvsp[0].expressions); }
+#line 2423 "c_parser.cpp"
+    break;
+
+  case 66: /* exprs: %empty  */
+#line 885 "c_parser.y"
+                                      { (yyval.expressions) = new std::vector<Expression*>(); }
+#line 2429 "c_parser.cpp"
+    break;
+
+  case 67: /* expr_list: expr_list COMMA expr  */
+#line 888 "c_parser.y"
+                                        { (yyval.expressions)->push_back((yyvsp[0].expression)); }
+#line 2435 "c_parser.cpp"
+    break;
+
+  case 68: /* expr_list: expr  */
+#line 889 "c_parser.y"
+                                                    { (yyval.expressions) = new std::vector<Expression*>({(yyvsp[0].expression)}); }
+#line 2441 "c_parser.cpp"
+    break;
+
+  case 69: /* expr: expr PLUS expr  */
+#line 892 "c_parser.y"
+                                {
+								if (((yyvsp[-2].expression)->getDataType() != Symbol::DataType::INT) || ((yyvsp[0].expression)->getDataType() != Symbol::DataType::INT))
+								{
+									yyerror("No match for operation '%s + %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::ADD, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2458 "c_parser.cpp"
+    break;
+
+  case 70: /* expr: expr MINUS expr  */
+#line 904 "c_parser.y"
+                                        {
+								if (((yyvsp[-2].expression)->getDataType() != Symbol::DataType::INT) || ((yyvsp[0].expression)->getDataType() != Symbol::DataType::INT))
+								{
+									yyerror("No match for operation '%s - %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::SUBTRACT, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2475 "c_parser.cpp"
+    break;
+
+  case 71: /* expr: expr MULTIPLY expr  */
+#line 917 "c_parser.y"
+                                        {
+								if (((yyvsp[-2].expression)->getDataType() != Symbol::DataType::INT) || ((yyvsp[0].expression)->getDataType() != Symbol::DataType::INT))
+								{
+									yyerror("No match for operation '%s * %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::MULTIPLY, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2492 "c_parser.cpp"
+    break;
+
+  case 72: /* expr: expr DIVIDE expr  */
+#line 929 "c_parser.y"
+                                        {
+								if (((yyvsp[-2].expression)->getDataType() != Symbol::DataType::INT) || ((yyvsp[0].expression)->getDataType() != Symbol::DataType::INT))
+								{
+									yyerror("No match for operation '%s / %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::DIVIDE, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2509 "c_parser.cpp"
+    break;
+
+  case 73: /* expr: expr MODULO expr  */
+#line 941 "c_parser.y"
+                                        {
+								if (((yyvsp[-2].expression)->getDataType() != Symbol::DataType::INT) || ((yyvsp[0].expression)->getDataType() != Symbol::DataType::INT))
+								{
+									yyerror("No match for operation '%s % %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::MODULO, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2526 "c_parser.cpp"
+    break;
+
+  case 74: /* expr: expr LESS expr  */
+#line 953 "c_parser.y"
+                                        {
+								if ((yyvsp[-2].expression)->getDataType() != (yyvsp[0].expression)->getDataType())
+								{
+									yyerror("No match for operation '%s < %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::LESS, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2543 "c_parser.cpp"
+    break;
+
+  case 75: /* expr: expr LESS_EQUAL expr  */
+#line 965 "c_parser.y"
+                                                {
+								if ((yyvsp[-2].expression)->getDataType() != (yyvsp[0].expression)->getDataType())
+								{
+									yyerror("No match for operation '%s <= %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::LESS_EQUAL, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2560 "c_parser.cpp"
+    break;
+
+  case 76: /* expr: expr GREATER expr  */
+#line 977 "c_parser.y"
+                                        {
+								if ((yyvsp[-2].expression)->getDataType() != (yyvsp[0].expression)->getDataType())
+								{
+									yyerror("No match for operation '%s > %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::GREATER, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2577 "c_parser.cpp"
+    break;
+
+  case 77: /* expr: expr GREATER_EQUAL expr  */
+#line 989 "c_parser.y"
+                                                {
+								if ((yyvsp[-2].expression)->getDataType() != (yyvsp[0].expression)->getDataType())
+								{
+									yyerror("No match for operation '%s >= %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::GREATER_EQUAL, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2594 "c_parser.cpp"
+    break;
+
+  case 78: /* expr: expr EQUAL expr  */
+#line 1001 "c_parser.y"
+                                                {
+								if ((yyvsp[-2].expression)->getDataType() != (yyvsp[0].expression)->getDataType())
+								{
+									yyerror("No match for operation '%s == %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::EQUAL, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2611 "c_parser.cpp"
+    break;
+
+  case 79: /* expr: expr NOT_EQUAL expr  */
+#line 1013 "c_parser.y"
+                                        {
+								if ((yyvsp[-2].expression)->getDataType() != (yyvsp[0].expression)->getDataType())
+								{
+									yyerror("No match for operation '%s != %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::NOT_EQUAL, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2628 "c_parser.cpp"
+    break;
+
+  case 80: /* expr: expr BIT_AND expr  */
+#line 1025 "c_parser.y"
+                                        {
+								if ((yyvsp[-2].expression)->getDataType() != (yyvsp[0].expression)->getDataType())
+								{
+									yyerror("No match for operation '%s & %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::BIT_AND, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2645 "c_parser.cpp"
+    break;
+
+  case 81: /* expr: expr BIT_OR expr  */
+#line 1037 "c_parser.y"
+                                        {
+								if ((yyvsp[-2].expression)->getDataType() != (yyvsp[0].expression)->getDataType())
+								{
+									yyerror("No match for operation '%s | %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::BIT_OR, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2662 "c_parser.cpp"
+    break;
+
+  case 82: /* expr: expr BIT_XOR expr  */
+#line 1049 "c_parser.y"
+                                        {
+								if ((yyvsp[-2].expression)->getDataType() != (yyvsp[0].expression)->getDataType())
+								{
+									yyerror("No match for operation '%s ^ %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::BIT_XOR, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2679 "c_parser.cpp"
+    break;
+
+  case 83: /* expr: expr SHIFT_LEFT expr  */
+#line 1061 "c_parser.y"
+                                                {
+								if (((yyvsp[-2].expression)->getDataType() != Symbol::DataType::INT) || ((yyvsp[0].expression)->getDataType() != Symbol::DataType::INT))
+								{
+									yyerror("No match for operation '%s << %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::SHIFT_LEFT, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2696 "c_parser.cpp"
+    break;
+
+  case 84: /* expr: expr SHIFT_RIGHT expr  */
+#line 1073 "c_parser.y"
+                                                {
+								if (((yyvsp[-2].expression)->getDataType() != Symbol::DataType::INT) || ((yyvsp[0].expression)->getDataType() != Symbol::DataType::INT))
+								{
+									yyerror("No match for operation '%s >> %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::SHIFT_RIGHT, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2713 "c_parser.cpp"
+    break;
+
+  case 85: /* expr: expr AND expr  */
+#line 1085 "c_parser.y"
+                                        {
+								if (((yyvsp[-2].expression)->getDataType() != Symbol::DataType::INT) || ((yyvsp[0].expression)->getDataType() != Symbol::DataType::INT))
+								{
+									yyerror("No match for operation '%s && %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::AND, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2730 "c_parser.cpp"
+    break;
+
+  case 86: /* expr: expr OR expr  */
+#line 1097 "c_parser.y"
+                                        {
+								if (((yyvsp[-2].expression)->getDataType() != Symbol::DataType::INT) || ((yyvsp[0].expression)->getDataType() != Symbol::DataType::INT))
+								{
+									yyerror("No match for operation '%s || %s'.",
+										Symbol::dataTypeToString((yyvsp[-2].expression)->getDataType()).c_str(),
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new BinaryExpression(Expression::Type::OR, Symbol::DataType::INT, (yyvsp[-2].expression), (yyvsp[0].expression));
+							}
+#line 2747 "c_parser.cpp"
+    break;
+
+  case 87: /* expr: NOT expr  */
+#line 1109 "c_parser.y"
+                                        {
+								if ((yyvsp[0].expression)->getDataType() != Symbol::DataType::INT)
+								{
+									yyerror("No match for operation '! %s'.",
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new UnaryExpression(Expression::Type::NOT, Symbol::DataType::INT, (yyvsp[0].expression));
+							}
+#line 2763 "c_parser.cpp"
+    break;
+
+  case 88: /* expr: BIT_NOT expr  */
+#line 1120 "c_parser.y"
+                                        {
+								if ((yyvsp[0].expression)->getDataType() != Symbol::DataType::INT)
+								{
+									yyerror("No match for operation '~ %s'.",
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new UnaryExpression(Expression::Type::BIT_NOT, Symbol::DataType::INT, (yyvsp[0].expression));
+							}
+#line 2779 "c_parser.cpp"
+    break;
+
+  case 89: /* expr: PLUS expr  */
+#line 1131 "c_parser.y"
+                                               {
+								if ((yyvsp[0].expression)->getDataType() != Symbol::DataType::INT)
+								{
+									yyerror("No match for operation '+ %s'.",
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = (yyvsp[0].expression); // Unary plus doesn't change anything
+							}
+#line 2795 "c_parser.cpp"
+    break;
+
+  case 90: /* expr: MINUS expr  */
+#line 1142 "c_parser.y"
+                                                 {
+								if ((yyvsp[0].expression)->getDataType() != Symbol::DataType::INT)
+								{
+									yyerror("No match for operation '- %s'.",
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								(yyval.expression) = new UnaryExpression(Expression::Type::NEG, Symbol::DataType::INT, (yyvsp[0].expression));
+							}
+#line 2811 "c_parser.cpp"
+    break;
+
+  case 91: /* expr: LEFT_PAREN TYPE RIGHT_PAREN expr  */
+#line 1153 "c_parser.y"
+                                                     {
+								// In case of typecast to same type, do nothing
+								if ((yyvsp[0].expression)->getDataType() == Symbol::stringToDataType(*(yyvsp[-2].strValue)))
+								{
+									(yyval.expression) = (yyvsp[0].expression);
+									delete (yyvsp[-2].strValue);
+								}
+								else if ((((yyvsp[0].expression)->getDataType() == Symbol::DataType::CHAR) && (Symbol::stringToDataType(*(yyvsp[-2].strValue)) == Symbol::DataType::INT)) ||
+									(((yyvsp[0].expression)->getDataType() == Symbol::DataType::CHAR) && (Symbol::stringToDataType(*(yyvsp[-2].strValue)) == Symbol::DataType::STRING)) ||
+									(((yyvsp[0].expression)->getDataType() == Symbol::DataType::INT) && (Symbol::stringToDataType(*(yyvsp[-2].strValue)) == Symbol::DataType::CHAR)))
+								{
+									(yyval.expression) = new UnaryExpression(Expression::Type::TYPECAST, Symbol::stringToDataType(*(yyvsp[-2].strValue)), (yyvsp[0].expression));
+									delete (yyvsp[-2].strValue);
+								}
+								else
+								{
+									yyerror("Unable to cast type '%s' to type '%s'.",
+										Symbol::dataTypeToString((yyvsp[0].expression)->getDataType()).c_str(),
+										(yyvsp[-2].strValue)->c_str());
+									delete (yyvsp[-2].strValue);
+									finalize(3);
+									YYERROR;
+								}
+							}
+#line 2840 "c_parser.cpp"
+    break;
+
+  case 92: /* expr: LEFT_PAREN expr RIGHT_PAREN  */
+#line 1177 "c_parser.y"
+                                                { (yyval.expression) = (yyvsp[-1].expression); }
+#line 2846 "c_parser.cpp"
+    break;
+
+  case 93: /* expr: ID LEFT_PAREN exprs RIGHT_PAREN  */
+#line 1179 "c_parser.y"
+                                {
+					std::vector<Symbol::DataType> paramDataTypes;
+					std::for_each((yyvsp[-1].expressions)->begin(), (yyvsp[-1].expressions)->end(), [&paramDataTypes](Expression* expr) { paramDataTypes.push_back(expr->getDataType()); });
+					std::string mangledName = NameMangler::mangle(*(yyvsp[-3].strValue), paramDataTypes);
+
+					// We can look for functions only in global space
+					Symbol* symbol = nullptr;
+					if ((symbol = context.globalSymbolTable()->findSymbol(mangledName)) == nullptr)
+					{
+						yyerror("Undeclared identifier '%s' used.", (yyvsp[-3].strValue)->c_str());
+						delete (yyvsp[-3].strValue);
+						delete (yyvsp[-1].expressions);
+						finalize(3);
+						YYERROR;
+					}
+
+					// Symbol needs to represent function
+					if (symbol->getType() != Symbol::Type::FUNCTION)
+					{
+						yyerror("Identifier '%s' is not a function.", (yyvsp[-3].strValue)->c_str());
+						delete (yyvsp[-3].strValue);
+						delete (yyvsp[-1].expressions);
+						finalize(3);
+						YYERROR;
+					}
+
+					// Check whether number of parameters match
+					FunctionSymbol* func = static_cast<FunctionSymbol*>(symbol);
+					if (func->getParameters().size() != (yyvsp[-1].expressions)->size())
+					{
+						yyerror("Unexpected amount of arguments provided when calling '%s'. Expected %u, got %u.",
+							(yyvsp[-3].strValue)->c_str(), func->getParameters().size(), (yyvsp[-1].expressions)->size());
+						delete (yyvsp[-3].strValue);
+						delete (yyvsp[-1].expressions);
+						finalize(3);
+						YYERROR;
+					}
+
+					const FunctionSymbol::ParameterList& paramList = func->getParameters();
+					for (uint32_t i = 0; i < paramList.size(); ++i)
+					{
+						if (paramList[i]->getDataType() != (yyvsp[-1].expressions)->at(i)->getDataType())
+						{
+							yyerror("Type mismatch for parameter on position %u in call of function '%s'. Expected %s, got %s.",
+									i, (yyvsp[-3].strValue)->c_str(),
+									Symbol::dataTypeToString((yyvsp[-1].expressions)->at(i)->getDataType()).c_str(),
+									Symbol::dataTypeToString(paramList[i]->getDataType()).c_str());
+							delete (yyvsp[-3].strValue);
+							delete (yyvsp[-1].expressions);
+							finalize(3);
+							YYERROR;
+						}
+					}
+
+					(yyval.expression) = new Call(func, *(yyvsp[-1].expressions));
+					delete (yyvsp[-3].strValue);
+					delete (yyvsp[-1].expressions);
+				}
+#line 2909 "c_parser.cpp"
+    break;
+
+  case 94: /* expr: BUILTIN LEFT_PAREN exprs RIGHT_PAREN  */
+#line 1238 "c_parser.y"
+                                {
+					Symbol::DataType returnType;
+					if (*(yyvsp[-3].strValue) == "print")
+					{
+						if ((yyvsp[-1].expressions)->size() < 1)
+						{
+							yyerror("Builtin function 'print' requires at least 1 argument.");
+							delete (yyvsp[-3].strValue);
+							delete (yyvsp[-1].expressions);
+							finalize(3);
+							YYERROR;
+						}
+
+						returnType = Symbol::DataType::VOID;
+					}
+					else if (*(yyvsp[-3].strValue) == "read_char")
+					{
+						if ((yyvsp[-1].expressions)->size() != 0)
+						{
+							yyerror("Builtin function 'read_char' requires 0 arguments.");
+							delete (yyvsp[-3].strValue);
+							delete (yyvsp[-1].expressions);
+							finalize(3);
+							YYERROR;
+						}
+
+						returnType = Symbol::DataType::CHAR;
+					}
+					else if (*(yyvsp[-3].strValue) == "read_int")
+					{
+						if ((yyvsp[-1].expressions)->size() != 0)
+						{
+							yyerror("Builtin function 'read_int' requires 0 arguments.");
+							delete (yyvsp[-3].strValue);
+							delete (yyvsp[-1].expressions);
+							finalize(3);
+							YYERROR;
+						}
+
+						returnType = Symbol::DataType::INT;
+					}
+					else if (*(yyvsp[-3].strValue) == "read_string")
+					{
+						if ((yyvsp[-1].expressions)->size() != 0)
+						{
+							yyerror("Builtin function 'read_string' requires 0 arguments.");
+							delete (yyvsp[-3].strValue);
+							delete (yyvsp[-1].expressions);
+							finalize(3);
+							YYERROR;
+						}
+
+						returnType = Symbol::DataType::STRING;
+					}
+					else if (*(yyvsp[-3].strValue) == "get_at")
+					{
+						if ((yyvsp[-1].expressions)->size() != 2)
+						{
+							yyerror("Builtin function 'get_at' requires 2 arguments.");
+							delete (yyvsp[-3].strValue);
+							delete (yyvsp[-1].expressions);
+							finalize(3);
+							YYERROR;
+						}
+
+						if (((yyvsp[-1].expressions)->at(0)->getDataType() != Symbol::DataType::STRING) || ((yyvsp[-1].expressions)->at(1)->getDataType() != Symbol::DataType::INT))
+						{
+							yyerror("Function 'get_at' requires its arguments type to be (string, int). Got (%s, %s).",
+								Symbol::dataTypeToString((yyvsp[-1].expressions)->at(0)->getDataType()).c_str(),
+								Symbol::dataTypeToString((yyvsp[-1].expressions)->at(1)->getDataType()).c_str());
+							delete (yyvsp[-3].strValue);
+							delete (yyvsp[-1].expressions);
+							finalize(3);
+							YYERROR;
+						}
+
+						returnType = Symbol::DataType::CHAR;
+					}
+					else if (*(yyvsp[-3].strValue) == "set_at")
+					{
+						if ((yyvsp[-1].expressions)->size() != 3)
+						{
+							yyerror("Builtin function 'set_at' requires 3 arguments.");
+							delete (yyvsp[-3].strValue);
+							delete (yyvsp[-1].expressions);
+							finalize(3);
+							YYERROR;
+						}
+
+						if (((yyvsp[-1].expressions)->at(0)->getDataType() != Symbol::DataType::STRING) || ((yyvsp[-1].expressions)->at(1)->getDataType() != Symbol::DataType::INT)
+							|| ((yyvsp[-1].expressions)->at(2)->getDataType() != Symbol::DataType::CHAR))
+						{
+							yyerror("Function 'set_at' requires its arguments type to be (string, int, char). Got (%s, %s, %s).",
+								Symbol::dataTypeToString((yyvsp[-1].expressions)->at(0)->getDataType()).c_str(),
+								Symbol::dataTypeToString((yyvsp[-1].expressions)->at(1)->getDataType()).c_str(),
+								Symbol::dataTypeToString((yyvsp[-1].expressions)->at(2)->getDataType()).c_str());
+							delete (yyvsp[-3].strValue);
+							delete (yyvsp[-1].expressions);
+							finalize(3);
+							YYERROR;
+						}
+
+						returnType = Symbol::DataType::STRING;
+					}
+					else if (*(yyvsp[-3].strValue) == "strcat")
+					{
+						if ((yyvsp[-1].expressions)->size() != 2)
+						{
+							yyerror("Builtin function 'strcat' requires 2 arguments.");
+							delete (yyvsp[-3].strValue);
+							delete (yyvsp[-1].expressions);
+							finalize(3);
+							YYERROR;
+						}
+
+						if (((yyvsp[-1].expressions)->at(0)->getDataType() != Symbol::DataType::STRING) || ((yyvsp[-1].expressions)->at(1)->getDataType() != Symbol::DataType::STRING))
+						{
+							yyerror("Function 'strcat' requires its arguments type to be (string, string). Got (%s, %s).",
+								Symbol::dataTypeToString((yyvsp[-1].expressions)->at(0)->getDataType()).c_str(),
+								Symbol::dataTypeToString((yyvsp[-1].expressions)->at(1)->getDataType()).c_str());
+							delete (yyvsp[-3].strValue);
+							delete (yyvsp[-1].expressions);
+							finalize(3);
+							YYERROR;
+						}
+
+						returnType = Symbol::DataType::STRING;
+					}
+					else if (*(yyvsp[-3].strValue) == "strlen")
+					{
+						if ((yyvsp[-1].expressions)->size() != 1)
+						{
+							yyerror("Builtin function 'strlen' requires 1 argument.");
+							delete (yyvsp[-3].strValue);
+							delete (yyvsp[-1].expressions);
+							finalize(3);
+							YYERROR;
+						}
+
+						if ((yyvsp[-1].expressions)->at(0)->getDataType() != Symbol::DataType::STRING)
+						{
+							yyerror("Function 'strlen' requires its arguments type to be (string). Got (%s).",
+								Symbol::dataTypeToString((yyvsp[-1].expressions)->at(0)->getDataType()).c_str());
+							delete (yyvsp[-3].strValue);
+							delete (yyvsp[-1].expressions);
+							finalize(3);
+							YYERROR;
+						}
+
+						returnType = Symbol::DataType::INT;
+					}
+					else if (*(yyvsp[-3].strValue) == "substr")
+					{
+						if ((yyvsp[-1].expressions)->size() != 3)
+						{
+							yyerror("Builtin function 'substr' requires 3 arguments.");
+							delete (yyvsp[-3].strValue);
+							delete (yyvsp[-1].expressions);
+							finalize(3);
+							YYERROR;
+						}
+
+						if (((yyvsp[-1].expressions)->at(0)->getDataType() != Symbol::DataType::STRING) || ((yyvsp[-1].expressions)->at(1)->getDataType() != Symbol::DataType::INT)
+							|| ((yyvsp[-1].expressions)->at(2)->getDataType() != Symbol::DataType::INT))
+						{
+							yyerror("Function 'substr' requires its arguments type to be (string, int, int). Got (%s, %s, %s).",
+								Symbol::dataTypeToString((yyvsp[-1].expressions)->at(0)->getDataType()).c_str(),
+								Symbol::dataTypeToString((yyvsp[-1].expressions)->at(1)->getDataType()).c_str(),
+								Symbol::dataTypeToString((yyvsp[-1].expressions)->at(2)->getDataType()).c_str());
+							delete (yyvsp[-3].strValue);
+							delete (yyvsp[-1].expressions);
+							finalize(3);
+							YYERROR;
+						}
+
+						returnType = Symbol::DataType::STRING;
+					}
+
+					(yyval.expression) = new BuiltinCall(*(yyvsp[-3].strValue), returnType, *(yyvsp[-1].expressions));
+					delete (yyvsp[-3].strValue);
+					delete (yyvsp[-1].expressions);
+				}
+#line 3096 "c_parser.cpp"
+    break;
+
+  case 95: /* expr: ID  */
+#line 1420 "c_parser.y"
+                        {
+					// Find the symbol that represents the variable
+					Symbol* symbol = context.findSymbol(*(yyvsp[0].strValue));
+					if (symbol == nullptr)
+					{
+						yyerror("Undeclared identifier '%s' used.", (yyvsp[0].strValue)->c_str());
+						delete (yyvsp[0].strValue);
+						finalize(3);
+						YYERROR;
+					}
+
+					if (symbol->getType() != Symbol::Type::VARIABLE)
+					{
+						yyerror("Identifier '%s' is not a variable.", symbol->getName().c_str());
+						delete (yyvsp[0].strValue);
+						finalize(3);
+						YYERROR;
+					}
+
+					VariableSymbol* varSymbol = static_cast<VariableSymbol*>(symbol);
+					if (varSymbol->isArray())
+					{
+						yyerror("Array '%s' cannot be used as a value.", varSymbol->getName().c_str());
+						delete (yyvsp[0].strValue);
+						finalize(3);
+						YYERROR;
+					}
+
+					(yyval.expression) = new Variable(varSymbol);
+					delete (yyvsp[0].strValue);
+				}
+#line 3132 "c_parser.cpp"
+    break;
+
+  case 96: /* expr: ID LEFT_BRACKET expr RIGHT_BRACKET  */
+#line 1451 "c_parser.y"
+                                                        {
+					Symbol* symbol = context.findSymbol(*(yyvsp[-3].strValue));
+					if (symbol == nullptr)
+					{
+						yyerror("Undeclared identifier '%s' used.", (yyvsp[-3].strValue)->c_str());
+						delete (yyvsp[-3].strValue);
+						finalize(3);
+						YYERROR;
+					}
+
+					if (symbol->getType() != Symbol::Type::VARIABLE || !static_cast<VariableSymbol*>(symbol)->isArray())
+					{
+						yyerror("Identifier '%s' is not an array.", symbol->getName().c_str());
+						delete (yyvsp[-3].strValue);
+						finalize(3);
+						YYERROR;
+					}
+
+					if ((yyvsp[-1].expression)->getDataType() != Symbol::DataType::INT)
+					{
+						yyerror("Array index is of type '%s'. Must be 'int'.",
+							Symbol::dataTypeToString((yyvsp[-1].expression)->getDataType()).c_str());
+						delete (yyvsp[-3].strValue);
+						finalize(3);
+						YYERROR;
+					}
+
+					(yyval.expression) = new ArrayElement(static_cast<VariableSymbol*>(symbol), (yyvsp[-1].expression));
+					delete (yyvsp[-3].strValue);
+				}
+#line 3167 "c_parser.cpp"
+    break;
+
+  case 97: /* expr: INT_LIT  */
+#line 1481 "c_parser.y"
+                            { (yyval.expression) = new IntLiteral((yyvsp[0].intValue)); }
+#line 3173 "c_parser.cpp"
+    break;
+
+  case 98: /* expr: CHAR_LIT  */
+#line 1482 "c_parser.y"
+                             { (yyval.expression) = new CharLiteral((yyvsp[0].charValue)); }
+#line 3179 "c_parser.cpp"
+    break;
+
+  case 99: /* expr: STRING_LIT  */
+#line 1483 "c_parser.y"
+                               { (yyval.expression) = new StringLiteral(*(yyvsp[0].strValue)); delete (yyvsp[0].strValue); }
+#line 3185 "c_parser.cpp"
+    break;
+
+
+#line 3189 "c_parser.cpp"
+
+      default: break;
+    }
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
+
+  YYPOPSTACK (yylen);
+  yylen = 0;
+
+  *++yyvsp = yyval;
+
+  /* Now 'shift' the result of the reduction.  Determine what state
+     that goes to, based on the state we popped back to and the rule
+     number reduced by.  */
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
+
+  goto yynewstate;
+
+
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
+yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
+  /* If not already recovering from an error, report this error.  */
+  if (!yyerrstatus)
+    {
+      ++yynerrs;
+      yyerror (YY_("syntax error"));
+    }
+
+  if (yyerrstatus == 3)
+    {
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
+
+      if (yychar <= YYEOF)
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
+      else
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval);
+          yychar = YYEMPTY;
+        }
+    }
+
+  /* Else will try to reuse lookahead token after shifting the error
+     token.  */
+  goto yyerrlab1;
+
+
+/*---------------------------------------------------.
+| yyerrorlab -- error raised explicitly by YYERROR.  |
+`---------------------------------------------------*/
+yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
+
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYERROR.  */
+  YYPOPSTACK (yylen);
+  yylen = 0;
+  YY_STACK_PRINT (yyss, yyssp);
+  yystate = *yyssp;
+  goto yyerrlab1;
+
+
+/*-------------------------------------------------------------.
+| yyerrlab1 -- common code for both syntax error and YYERROR.  |
+`-------------------------------------------------------------*/
+yyerrlab1:
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
+
+  /* Pop stack until we find a state that shifts the error token.  */
+  for (;;)
+    {
+      yyn = yypact[yystate];
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
+
+      /* Pop the current state because it cannot handle the error token.  */
+      if (yyssp == yyss)
+        YYABORT;
+
+
+      yydestruct ("Error: popping",
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
+      YYPOPSTACK (1);
+      yystate = *yyssp;
+      YY_STACK_PRINT (yyss, yyssp);
+    }
+
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
+
+
+  /* Shift the error token.  */
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
+
+  yystate = yyn;
+  goto yynewstate;
+
+
+/*-------------------------------------.
+| yyacceptlab -- YYACCEPT comes here.  |
+`-------------------------------------*/
+yyacceptlab:
+  yyresult = 0;
+  goto yyreturnlab;
+
+
+/*-----------------------------------.
+| yyabortlab -- YYABORT comes here.  |
+`-----------------------------------*/
+yyabortlab:
+  yyresult = 1;
+  goto yyreturnlab;
+
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
+yyexhaustedlab:
+  yyerror (YY_("memory exhausted"));
+  yyresult = 2;
+  goto yyreturnlab;
+
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
+     this YYABORT or YYACCEPT.  */
+  YYPOPSTACK (yylen);
+  YY_STACK_PRINT (yyss, yyssp);
+  while (yyssp != yyss)
+    {
+      yydestruct ("Cleanup: popping",
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
+      YYPOPSTACK (1);
+    }
+#ifndef yyoverflow
+  if (yyss != yyssa)
+    YYSTACK_FREE (yyss);
+#endif
+
+  return yyresult;
+}
+
+#line 1486 "c_parser.y"
+
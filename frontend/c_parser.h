@@ -0,0 +1,140 @@
+/* A Bison parser, made by GNU Bison 3.8.2.  */
+
+/* Bison interface for Yacc-like parsers in C
+
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
+
+   This program is free software: you can redistribute it and/or modify
+   it under the terms of the GNU General Public License as published by
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+   GNU General Public License for more details.
+
+   You should have received a copy of the GNU General Public License
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
+
+/* As a special exception, you may create a larger work that contains
+   part or all of the Bison parser skeleton and distribute that work
+   under terms of your choice, so long as that work isn't itself a
+   parser generator using the skeleton or a modified version thereof
+   as a parser skeleton.  Alternatively, if you modify or redistribute
+   the parser skeleton itself, you may (at your option) remove this
+   special exception, which will cause the skeleton and the resulting
+   Bison output files to be licensed under the GNU General Public
+   License without this special exception.
+
+   This special exception was added by the Free Software Foundation in
+   version 2.2 of Bison.  */
+
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
+#ifndef YY_YY_C_PARSER_H_INCLUDED
+# define YY_YY_C_PARSER_H_INCLUDED
+/* Debug traces.  */
+#ifndef YYDEBUG
+# define YYDEBUG 1
+#endif
+#if YYDEBUG
+extern int yydebug;
+#endif
+
+/* Token kinds.  */
+#ifndef YYTOKENTYPE
+# define YYTOKENTYPE
+  enum yytokentype
+  {
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    COMMA = 258,                   /* COMMA  */
+    SEMICOLON = 259,               /* SEMICOLON  */
+    ASSIGN = 260,                  /* ASSIGN  */
+    LEFT_PAREN = 261,              /* LEFT_PAREN  */
+    RIGHT_PAREN = 262,             /* RIGHT_PAREN  */
+    LEFT_CBRACE = 263,             /* LEFT_CBRACE  */
+    RIGHT_CBRACE = 264,            /* RIGHT_CBRACE  */
+    LEFT_BRACKET = 265,            /* LEFT_BRACKET  */
+    RIGHT_BRACKET = 266,           /* RIGHT_BRACKET  */
+    PLUS = 267,                    /* PLUS  */
+    MINUS = 268,                   /* MINUS  */
+    MULTIPLY = 269,                /* MULTIPLY  */
+    DIVIDE = 270,                  /* DIVIDE  */
+    MODULO = 271,                  /* MODULO  */
+    NOT = 272,                     /* NOT  */
+    LESS = 273,                    /* LESS  */
+    LESS_EQUAL = 274,              /* LESS_EQUAL  */
+    GREATER = 275,                 /* GREATER  */
+    GREATER_EQUAL = 276,           /* GREATER_EQUAL  */
+    EQUAL = 277,                   /* EQUAL  */
+    NOT_EQUAL = 278,               /* NOT_EQUAL  */
+    AND = 279,                     /* AND  */
+    OR = 280,                      /* OR  */
+    IF = 281,                      /* IF  */
+    ELSE = 282,                    /* ELSE  */
+    WHILE = 283,                   /* WHILE  */
+    FOR = 284,                     /* FOR  */
+    RETURN = 285,                  /* RETURN  */
+    VOID = 286,                    /* VOID  */
+    BIT_AND = 287,                 /* BIT_AND  */
+    BIT_OR = 288,                  /* BIT_OR  */
+    BIT_XOR = 289,                 /* BIT_XOR  */
+    BIT_NOT = 290,                 /* BIT_NOT  */
+    SHIFT_LEFT = 291,              /* SHIFT_LEFT  */
+    SHIFT_RIGHT = 292,             /* SHIFT_RIGHT  */
+    RESERVED = 293,                /* RESERVED  */
+    INT_LIT = 294,                 /* INT_LIT  */
+    CHAR_LIT = 295,                /* CHAR_LIT  */
+    STRING_LIT = 296,              /* STRING_LIT  */
+    ID = 297,                      /* ID  */
+    TYPE = 298,                    /* TYPE  */
+    BUILTIN = 299,                 /* BUILTIN  */
+    UNARY_PLUS = 300,              /* UNARY_PLUS  */
+    UNARY_MINUS = 301              /* UNARY_MINUS  */
+  };
+  typedef enum yytokentype yytoken_kind_t;
+#endif
+
+/* Value type.  */
+#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
+union YYSTYPE
+{
+#line 24 "c_parser.y"
+
+	frontend::Function* function;
+	frontend::FunctionSymbol::ParameterList* functionParameters;
+	frontend::StatementBlock* statements;
+	frontend::Statement* statement;
+	std::vector<frontend::Expression*>* expressions;
+	frontend::Expression* expression;
+	frontend::Declaration* declaration;
+	std::vector<frontend::Declaration*>* declList;
+	frontend::AssignStatement* forInitStmt;
+	frontend::ForIterationStatement* forIterStmt;
+	std::string* strValue;
+	char charValue;
+	int intValue;
+
+#line 126 "c_parser.h"
+
+};
+typedef union YYSTYPE YYSTYPE;
+# define YYSTYPE_IS_TRIVIAL 1
+# define YYSTYPE_IS_DECLARED 1
+#endif
+
+
+extern YYSTYPE yylval;
+
+
+int yyparse (void);
+
+
+#endif /* !YY_YY_C_PARSER_H_INCLUDED  */
@@ -28,6 +28,7 @@ extern void finalize(int exitCode);
 	frontend::Statement* statement;
 	std::vector<frontend::Expression*>* expressions;
 	frontend::Expression* expression;
+	frontend::Declaration* declaration;
 	std::vector<frontend::Declaration*>* declList;
 	frontend::AssignStatement* forInitStmt;
 	frontend::ForIterationStatement* forIterStmt;
@@ -36,9 +37,9 @@ extern void finalize(int exitCode);
 	int intValue;
 }
 
-%token COMMA SEMICOLON ASSIGN LEFT_PAREN RIGHT_PAREN LEFT_CBRACE RIGHT_CBRACE PLUS MINUS
+%token COMMA SEMICOLON ASSIGN LEFT_PAREN RIGHT_PAREN LEFT_CBRACE RIGHT_CBRACE LEFT_BRACKET RIGHT_BRACKET PLUS MINUS
 	MULTIPLY DIVIDE MODULO NOT LESS LESS_EQUAL GREATER GREATER_EQUAL EQUAL NOT_EQUAL AND OR
-	IF ELSE WHILE FOR RETURN VOID BIT_AND BIT_OR BIT_NOT RESERVED
+	IF ELSE WHILE FOR RETURN VOID BIT_AND BIT_OR BIT_XOR BIT_NOT SHIFT_LEFT SHIFT_RIGHT RESERVED
 %token <intValue> INT_LIT
 %token <charValue> CHAR_LIT
 %token <strValue> STRING_LIT ID TYPE BUILTIN
@@ -49,6 +50,7 @@ extern void finalize(int exitCode);
 %type <statement> stmt assign_stmt decl_stmt if_stmt while_stmt for_stmt return_stmt call_stmt empty_stmt
 %type <expressions> exprs expr_list
 %type <expression> expr decl_init_expr for_cond
+%type <declaration> decl_id
 %type <declList> decl_id_list
 %type <forInitStmt> for_init
 %type <forIterStmt> for_iter
@@ -56,9 +58,11 @@ extern void finalize(int exitCode);
 %left OR
 %left AND
 %left BIT_OR
+%left BIT_XOR
 %left BIT_AND
 %left EQUAL NOT_EQUAL
 %left LESS LESS_EQUAL GREATER GREATER_EQUAL
+%left SHIFT_LEFT SHIFT_RIGHT
 %left PLUS MINUS
 %left MULTIPLY DIVIDE MODULO
 %right NOT BIT_NOT UNARY_PLUS UNARY_MINUS
@@ -307,6 +311,14 @@ assign_stmt :   ID ASSIGN expr SEMICOLON    {
 												}
 
 												VariableSymbol* varSymbol = static_cast<VariableSymbol*>(symbol);
+												if (varSymbol->isArray())
+												{
+													yyerror("Unable to assign to array '%s'.", varSymbol->getName().c_str());
+													delete $1;
+													finalize(3);
+													YYERROR;
+												}
+
 												if (varSymbol->getDataType() != $3->getDataType())
 												{
 													yyerror("Unable to assign '%s' to variable '%s' of type '%s'.",
@@ -321,6 +333,48 @@ assign_stmt :   ID ASSIGN expr SEMICOLON    {
 												$$ = new AssignStatement(varSymbol, $3);
 												delete $1;
 											}
+			|   ID LEFT_BRACKET expr RIGHT_BRACKET ASSIGN expr SEMICOLON    {
+												Symbol* symbol = context.findSymbol(*$1);
+												if (symbol == nullptr || symbol->getType() != Symbol::Type::VARIABLE)
+												{
+													yyerror("Assignment to undefined symbol '%s'.", $1->c_str());
+													delete $1;
+													finalize(3);
+													YYERROR;
+												}
+
+												VariableSymbol* varSymbol = static_cast<VariableSymbol*>(symbol);
+												if (!varSymbol->isArray())
+												{
+													yyerror("Variable '%s' is not an array.", varSymbol->getName().c_str());
+													delete $1;
+													finalize(3);
+													YYERROR;
+												}
+
+												if ($3->getDataType() != Symbol::DataType::INT)
+												{
+													yyerror("Array index is of type '%s'. Must be 'int'.",
+																Symbol::dataTypeToString($3->getDataType()).c_str());
+													delete $1;
+													finalize(3);
+													YYERROR;
+												}
+
+												if (varSymbol->getDataType() != $6->getDataType())
+												{
+													yyerror("Unable to assign '%s' to element of array '%s' of type '%s'.",
+																Symbol::dataTypeToString($6->getDataType()).c_str(),
+																varSymbol->getName().c_str(),
+																Symbol::dataTypeToString(varSymbol->getDataType()).c_str());
+													delete $1;
+													finalize(3);
+													YYERROR;
+												}
+
+												$$ = new ArrayElementAssignStatement(varSymbol, $3, $6);
+												delete $1;
+											}
 			;
 
 decl_stmt   :   TYPE                            { context.setCurrentDeclaredVarType(Symbol::stringToDataType(*$1)); }
@@ -331,48 +385,52 @@ decl_stmt   :   TYPE                            { context.setCurrentDeclaredVarT
 											}
 			;
 
-decl_id_list    :   decl_id_list COMMA ID decl_init_expr   {
+decl_id_list    :   decl_id_list COMMA decl_id      { $$->push_back($3); }
+				|   decl_id                         { $$ = new std::vector<Declaration*>( { $1 } ); }
+				;
+
+decl_id         :   ID decl_init_expr               {
 														Symbol* symbol = nullptr;
-														if ((symbol = context.findSymbol(*$3)) != nullptr)
+														if ((symbol = context.findSymbol(*$1)) != nullptr)
 														{
 															// We cannot shadow functions
 															if (symbol->getType() != Symbol::Type::VARIABLE)
 															{
 																yyerror("Redefinition of symbol '%s'. Cannot shadow functions.", symbol->getName().c_str());
 																delete $1;
-																delete $3;
+																delete $2;
 																finalize(3);
 																YYERROR;
 															}
 														}
 
 														// Adding can fail if there is symbol in the same block, we cannot shadow in the same block
-														if ((symbol = context.currentSymbolTable()->addVariable(*$3, context.getCurrentDeclaredVarType())) == nullptr)
+														if ((symbol = context.currentSymbolTable()->addVariable(*$1, context.getCurrentDeclaredVarType())) == nullptr)
 														{
-															yyerror("Redefinition of symbol '%s'.", $3->c_str());
+															yyerror("Redefinition of symbol '%s'.", $1->c_str());
 															delete $1;
-															delete $3;
+															delete $2;
 															finalize(3);
 															YYERROR;
 														}
 
 														VariableSymbol* varSymbol = static_cast<VariableSymbol*>(symbol);
-														if ($4 && $4->getDataType() != varSymbol->getDataType())
+														if ($2 && $2->getDataType() != varSymbol->getDataType())
 														{
 															yyerror("Unable to initialize variable '%s' of type '%s' with '%s'.",
 																		varSymbol->getName().c_str(),
 																		Symbol::dataTypeToString(varSymbol->getDataType()).c_str(),
-																		Symbol::dataTypeToString($4->getDataType()).c_str());
+																		Symbol::dataTypeToString($2->getDataType()).c_str());
 															delete $1;
-															delete $3;
+															delete $2;
 															finalize(3);
 															YYERROR;
 														}
 
-														$$->push_back(new Declaration(varSymbol, $4));
-														delete $3;
+														$$ = new Declaration(varSymbol, $2);
+														delete $1;
 													}
-				|   ID decl_init_expr               {
+				|   ID LEFT_BRACKET INT_LIT RIGHT_BRACKET   {
 														Symbol* symbol = nullptr;
 														if ((symbol = context.findSymbol(*$1)) != nullptr)
 														{
@@ -381,36 +439,47 @@ decl_id_list    :   decl_id_list COMMA ID decl_init_expr   {
 															{
 																yyerror("Redefinition of symbol '%s'. Cannot shadow functions.", symbol->getName().c_str());
 																delete $1;
-																delete $2;
 																finalize(3);
 																YYERROR;
 															}
 														}
 
-														// Adding can fail if there is symbol in the same block, we cannot shadow in the same block
-														if ((symbol = context.currentSymbolTable()->addVariable(*$1, context.getCurrentDeclaredVarType())) == nullptr)
+														// Only characters and integers have fixed size
+														Symbol::DataType dataType = context.getCurrentDeclaredVarType();
+														if (dataType != Symbol::DataType::INT && dataType != Symbol::DataType::CHAR)
 														{
-															yyerror("Redefinition of symbol '%s'.", $1->c_str());
+															yyerror("Unable to declare array '%s' of type '%s'.", $1->c_str(), Symbol::dataTypeToString(dataType).c_str());
 															delete $1;
-															delete $2;
 															finalize(3);
 															YYERROR;
 														}
 
-														VariableSymbol* varSymbol = static_cast<VariableSymbol*>(symbol);
-														if ($2 && $2->getDataType() != varSymbol->getDataType())
+														if ($3 <= 0)
 														{
-															yyerror("Unable to initialize variable '%s' of type '%s' with '%s'.",
-																		varSymbol->getName().c_str(),
-																		Symbol::dataTypeToString(varSymbol->getDataType()).c_str(),
-																		Symbol::dataTypeToString($2->getDataType()).c_str());
+															yyerror("Array '%s' must have at least one element.", $1->c_str());
+															delete $1;
+															finalize(3);
+															YYERROR;
+														}
+
+														if (!context.reserveArrayBytes($3, dataType == Symbol::DataType::INT ? 4 : 1))
+														{
+															yyerror("Array '%s' does not fit on the stack.", $1->c_str());
 															delete $1;
-															delete $2;
 															finalize(3);
 															YYERROR;
 														}
 
-														$$ = new std::vector<Declaration*>( { new Declaration(varSymbol, $2) } );
+														// Adding can fail if there is symbol in the same block, we cannot shadow in the same block
+														if ((symbol = context.currentSymbolTable()->addVariable(*$1, dataType, $3)) == nullptr)
+														{
+															yyerror("Redefinition of symbol '%s'.", $1->c_str());
+															delete $1;
+															finalize(3);
+															YYERROR;
+														}
+
+														$$ = new Declaration(static_cast<VariableSymbol*>(symbol), nullptr);
 														delete $1;
 													}
 				;
@@ -487,6 +556,14 @@ for_init    :   ID ASSIGN expr                      {
 														}
 
 														VariableSymbol* varSymbol = static_cast<VariableSymbol*>(symbol);
+														if (varSymbol->isArray())
+														{
+															yyerror("Unable to assign to array '%s'.", varSymbol->getName().c_str());
+															delete $1;
+															finalize(3);
+															YYERROR;
+														}
+
 														if (varSymbol->getDataType() != $3->getDataType())
 														{
 															yyerror("Unable to assign '%s' to variable '%s' of type '%s'.",
@@ -519,6 +596,14 @@ for_iter    :   ID ASSIGN expr                      {
 														}
 
 														VariableSymbol* varSymbol = static_cast<VariableSymbol*>(symbol);
+														if (varSymbol->isArray())
+														{
+															yyerror("Unable to assign to array '%s'.", varSymbol->getName().c_str());
+															delete $1;
+															finalize(3);
+															YYERROR;
+														}
+
 														if (varSymbol->getDataType() != $3->getDataType())
 														{
 															yyerror("Unable to assign '%s' to variable '%s' of type '%s'.",
@@ -734,6 +819,51 @@ call_stmt   :   ID LEFT_PAREN exprs RIGHT_PAREN SEMICOLON   {
 																		YYERROR;
 																	}
 																}
+																else if (*$1 == "strlen")
+																{
+																	if ($3->size() != 1)
+																	{
+																		yyerror("Builtin function 'strlen' requires 1 argument.");
+																		delete $1;
+																		delete $3;
+																		finalize(3);
+																		YYERROR;
+																	}
+
+																	if ($3->at(0)->getDataType() != Symbol::DataType::STRING)
+																	{
+																		yyerror("Function 'strlen' requires its arguments type to be (string). Got (%s).",
+																			Symbol::dataTypeToString($3->at(0)->getDataType()).c_str());
+																		delete $1;
+																		delete $3;
+																		finalize(3);
+																		YYERROR;
+																	}
+																}
+																else if (*$1 == "substr")
+																{
+																	if ($3->size() != 3)
+																	{
+																		yyerror("Builtin function 'substr' requires 3 arguments.");
+																		delete $1;
+																		delete $3;
+																		finalize(3);
+																		YYERROR;
+																	}
+
+																	if (($3->at(0)->getDataType() != Symbol::DataType::STRING) || ($3->at(1)->getDataType() != Symbol::DataType::INT)
+																		|| ($3->at(2)->getDataType() != Symbol::DataType::INT))
+																	{
+																		yyerror("Function 'substr' requires its arguments type to be (string, int, int). Got (%s, %s, %s).",
+																			Symbol::dataTypeToString($3->at(0)->getDataType()).c_str(),
+																			Symbol::dataTypeToString($3->at(1)->getDataType()).c_str(),
+																			Symbol::dataTypeToString($3->at(2)->getDataType()).c_str());
+																		delete $1;
+																		delete $3;
+																		finalize(3);
+																		YYERROR;
+																	}
+																}
 																else
 																{
 																	yyerror("Builtin function '%s' cannot be in form of statement.", $1->c_str());
@@ -916,6 +1046,42 @@ expr    :   expr PLUS expr	{
 
 								$$ = new BinaryExpression(Expression::Type::BIT_OR, Symbol::DataType::INT, $1, $3);
 							}
+		|   expr BIT_XOR expr	{
+								if ($1->getDataType() != $3->getDataType())
+								{
+									yyerror("No match for operation '%s ^ %s'.",
+										Symbol::dataTypeToString($1->getDataType()).c_str(),
+										Symbol::dataTypeToString($3->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								$$ = new BinaryExpression(Expression::Type::BIT_XOR, Symbol::DataType::INT, $1, $3);
+							}
+		|   expr SHIFT_LEFT expr	{
+								if (($1->getDataType() != Symbol::DataType::INT) || ($3->getDataType() != Symbol::DataType::INT))
+								{
+									yyerror("No match for operation '%s << %s'.",
+										Symbol::dataTypeToString($1->getDataType()).c_str(),
+										Symbol::dataTypeToString($3->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								$$ = new BinaryExpression(Expression::Type::SHIFT_LEFT, Symbol::DataType::INT, $1, $3);
+							}
+		|   expr SHIFT_RIGHT expr	{
+								if (($1->getDataType() != Symbol::DataType::INT) || ($3->getDataType() != Symbol::DataType::INT))
+								{
+									yyerror("No match for operation '%s >> %s'.",
+										Symbol::dataTypeToString($1->getDataType()).c_str(),
+										Symbol::dataTypeToString($3->getDataType()).c_str());
+									finalize(3);
+									YYERROR;
+								}
+
+								$$ = new BinaryExpression(Expression::Type::SHIFT_RIGHT, Symbol::DataType::INT, $1, $3);
+							}
 		|   expr AND expr	{
 								if (($1->getDataType() != Symbol::DataType::INT) || ($3->getDataType() != Symbol::DataType::INT))
 								{
@@ -1197,6 +1363,55 @@ expr    :   expr PLUS expr	{
 
 						returnType = Symbol::DataType::STRING;
 					}
+					else if (*$1 == "strlen")
+					{
+						if ($3->size() != 1)
+						{
+							yyerror("Builtin function 'strlen' requires 1 argument.");
+							delete $1;
+							delete $3;
+							finalize(3);
+							YYERROR;
+						}
+
+						if ($3->at(0)->getDataType() != Symbol::DataType::STRING)
+						{
+							yyerror("Function 'strlen' requires its arguments type to be (string). Got (%s).",
+								Symbol::dataTypeToString($3->at(0)->getDataType()).c_str());
+							delete $1;
+							delete $3;
+							finalize(3);
+							YYERROR;
+						}
+
+						returnType = Symbol::DataType::INT;
+					}
+					else if (*$1 == "substr")
+					{
+						if ($3->size() != 3)
+						{
+							yyerror("Builtin function 'substr' requires 3 arguments.");
+							delete $1;
+							delete $3;
+							finalize(3);
+							YYERROR;
+						}
+
+						if (($3->at(0)->getDataType() != Symbol::DataType::STRING) || ($3->at(1)->getDataType() != Symbol::DataType::INT)
+							|| ($3->at(2)->getDataType() != Symbol::DataType::INT))
+						{
+							yyerror("Function 'substr' requires its arguments type to be (string, int, int). Got (%s, %s, %s).",
+								Symbol::dataTypeToString($3->at(0)->getDataType()).c_str(),
+								Symbol::dataTypeToString($3->at(1)->getDataType()).c_str(),
+								Symbol::dataTypeToString($3->at(2)->getDataType()).c_str());
+							delete $1;
+							delete $3;
+							finalize(3);
+							YYERROR;
+						}
+
+						returnType = Symbol::DataType::STRING;
+					}
 
 					$$ = new BuiltinCall(*$1, returnType, *$3);
 					delete $1;
@@ -1221,7 +1436,46 @@ expr    :   expr PLUS expr	{
 						YYERROR;
 					}
 
-					$$ = new Variable(static_cast<VariableSymbol*>(symbol));
+					VariableSymbol* varSymbol = static_cast<VariableSymbol*>(symbol);
+					if (varSymbol->isArray())
+					{
+						yyerror("Array '%s' cannot be used as a value.", varSymbol->getName().c_str());
+						delete $1;
+						finalize(3);
+						YYERROR;
+					}
+
+					$$ = new Variable(varSymbol);
+					delete $1;
+				}
+		|   ID LEFT_BRACKET expr RIGHT_BRACKET  {
+					Symbol* symbol = context.findSymbol(*$1);
+					if (symbol == nullptr)
+					{
+						yyerror("Undeclared identifier '%s' used.", $1->c_str());
+						delete $1;
+						finalize(3);
+						YYERROR;
+					}
+
+					if (symbol->getType() != Symbol::Type::VARIABLE || !static_cast<VariableSymbol*>(symbol)->isArray())
+					{
+						yyerror("Identifier '%s' is not an array.", symbol->getName().c_str());
+						delete $1;
+						finalize(3);
+						YYERROR;
+					}
+
+					if ($3->getDataType() != Symbol::DataType::INT)
+					{
+						yyerror("Array index is of type '%s'. Must be 'int'.",
+							Symbol::dataTypeToString($3->getDataType()).c_str());
+						delete $1;
+						finalize(3);
+						YYERROR;
+					}
+
+					$$ = new ArrayElement(static_cast<VariableSymbol*>(symbol), $3);
 					delete $1;
 				}
 		|   INT_LIT { $$ = new IntLiteral($1); }
@@ -7,8 +7,12 @@
 
 namespace frontend {
 
+// Program starts with $sp at 1 MiB and the stack grows down towards code, constant data
+// and the heap, so arrays of a function may take at most half of the address space
+const long long MaxArrayBytes = 0x80000;
+
 Context::Context() : _globalSymTable(new SymbolTable), _symTableStack(), _allSymbolTables(),
-	_currentFunction(nullptr), _currentDeclaredVarType(Symbol::DataType::VOID)
+	_currentFunction(nullptr), _currentArrayBytes(0), _currentDeclaredVarType(Symbol::DataType::VOID)
 {
 }
 
@@ -49,6 +53,7 @@ SymbolTable* Context::currentSymbolTable()
 void Context::setCurrentFunction(FunctionSymbol* currentFunction)
 {
 	_currentFunction = currentFunction;
+	_currentArrayBytes = 0;
 }
 
 FunctionSymbol* Context::getCurrentFunction() const
@@ -56,6 +61,17 @@ FunctionSymbol* Context::getCurrentFunction() const
 	return _currentFunction;
 }
 
+bool Context::reserveArrayBytes(int elements, int elementSize)
+{
+	// Backend keeps arrays word aligned
+	long long bytes = (static_cast<long long>(elements) * elementSize + 3) & ~3LL;
+	if (elements <= 0 || _currentArrayBytes + bytes > MaxArrayBytes)
+		return false;
+
+	_currentArrayBytes += bytes;
+	return true;
+}
+
 Symbol::DataType Context::getCurrentDeclaredVarType() const
 {
 	return _currentDeclaredVarType;
@@ -30,6 +30,9 @@ public:
 	FunctionSymbol* getCurrentFunction() const;
 	void setCurrentFunction(FunctionSymbol* currentFunction);
 
+	// Arrays live on the stack, all arrays of the current function may take at most 512 KiB
+	bool reserveArrayBytes(int elements, int elementSize);
+
 	Symbol::DataType getCurrentDeclaredVarType() const;
 	void setCurrentDeclaredVarType(Symbol::DataType dataType);
 
@@ -43,6 +46,7 @@ private:
 	StackType _symTableStack;
 	StackType _allSymbolTables;
 	FunctionSymbol* _currentFunction;
+	long long _currentArrayBytes;
 	Symbol::DataType _currentDeclaredVarType;
 };
 
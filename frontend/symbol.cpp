@@ -81,8 +81,8 @@ void Symbol::setIrValue(ir::Value* irValue)
 	_irValue = irValue;
 }
 
-VariableSymbol::VariableSymbol(const std::string& name, Symbol::DataType dataType)
-	: Symbol(Symbol::Type::VARIABLE, name), _dataType(dataType)
+VariableSymbol::VariableSymbol(const std::string& name, Symbol::DataType dataType, int arraySize)
+	: Symbol(Symbol::Type::VARIABLE, name), _dataType(dataType), _arraySize(arraySize)
 {
 }
 
@@ -100,6 +100,16 @@ void VariableSymbol::setDataType(Symbol::DataType dataType)
 	_dataType = dataType;
 }
 
+int VariableSymbol::getArraySize() const
+{
+	return _arraySize;
+}
+
+bool VariableSymbol::isArray() const
+{
+	return _arraySize > 0;
+}
+
 FunctionSymbol::FunctionSymbol(const std::string& name, Symbol::DataType returnType, const ParameterList& parameters, bool definition)
 		: Symbol(Symbol::Type::FUNCTION, name), _returnType(returnType), _parameters(parameters), _defined(definition)
 {
@@ -62,17 +62,21 @@ class VariableSymbol : public Symbol
 {
 public:
 	VariableSymbol() = delete;
-	VariableSymbol(const std::string& name, DataType dataType);
+	VariableSymbol(const std::string& name, DataType dataType, int arraySize = 0);
 	VariableSymbol(const VariableSymbol&) = delete;
 	virtual ~VariableSymbol();
 
 	DataType getDataType() const;
 	void setDataType(DataType dataType);
 
+	int getArraySize() const;
+	bool isArray() const;
+
 private:
 	VariableSymbol& operator =(const VariableSymbol&);
 
 	DataType _dataType;
+	int _arraySize;
 };
 
 class FunctionSymbol : public Symbol
@@ -39,13 +39,13 @@ VariableSymbol* SymbolTable::addVariable(VariableSymbol* variableSymbol)
 	return variableSymbol;
 }
 
-VariableSymbol* SymbolTable::addVariable(const std::string& name, Symbol::DataType dataType)
+VariableSymbol* SymbolTable::addVariable(const std::string& name, Symbol::DataType dataType, int arraySize)
 {
 	// Check whether symbol with this name already exists in the current table
 	if (findSymbol(name))
 		return nullptr;
 
-	return addVariable(new VariableSymbol(name, dataType));
+	return addVariable(new VariableSymbol(name, dataType, arraySize));
 }
 
 FunctionSymbol* SymbolTable::addFunction(const std::string& name, Symbol::DataType returnType, const FunctionSymbol::ParameterList& parameters, bool definition)
@@ -24,7 +24,7 @@ public:
 	const TableType& getAllSymbols() const;
 
 	VariableSymbol* addVariable(VariableSymbol* variableSymbol);
-	VariableSymbol* addVariable(const std::string& name, Symbol::DataType dataType);
+	VariableSymbol* addVariable(const std::string& name, Symbol::DataType dataType, int arraySize = 0);
 	FunctionSymbol* addFunction(const std::string& name, Symbol::DataType returnType, const FunctionSymbol::ParameterList& parameters, bool definition);
 
 	Symbol* findSymbol(const std::string& name);
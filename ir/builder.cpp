@@ -151,6 +151,24 @@ Value* Builder::createDeclaration(const std::string& name, Value::DataType dataT
 	return value;
 }
 
+Value* Builder::createArrayDeclaration(const std::string& name, Value::DataType dataType, int arraySize)
+{
+	NamedValue* value = static_cast<NamedValue*>(createNamedValue(dataType, name));
+	value->setArraySize(arraySize);
+	_activeBasicBlock->addInstruction(new DeclarationInstruction(value));
+	return value;
+}
+
+Value* Builder::createLoadIndexed(Value* array, Value* index)
+{
+	if (index->getType() == Value::Type::NAMED)
+		_activeBasicBlock->addUse(index);
+
+	Value* resultValue = createTemporaryValue(array->getDataType());
+	_activeBasicBlock->addInstruction(new LoadIndexedInstruction(resultValue, array, index));
+	return resultValue;
+}
+
 template Value* Builder::createUnaryOperation<NotInstruction>(Value* operand, Value::DataType resultDataType);
 template Value* Builder::createUnaryOperation<TypecastInstruction>(Value* operand, Value::DataType resultDataType);
 template Value* Builder::createUnaryOperation<BitwiseNotInstruction>(Value* operand, Value::DataType resultDataType);
@@ -183,6 +201,9 @@ template Value* Builder::createBinaryOperation<AndInstruction>(Value* leftOperan
 template Value* Builder::createBinaryOperation<OrInstruction>(Value* leftOperand, Value* rightOperand, Value::DataType resultDataType);
 template Value* Builder::createBinaryOperation<BitwiseAndInstruction>(Value* leftOperand, Value* rightOperand, Value::DataType resultDataType);
 template Value* Builder::createBinaryOperation<BitwiseOrInstruction>(Value* leftOperand, Value* rightOperand, Value::DataType resultDataType);
+template Value* Builder::createBinaryOperation<BitwiseXorInstruction>(Value* leftOperand, Value* rightOperand, Value::DataType resultDataType);
+template Value* Builder::createBinaryOperation<ShiftLeftInstruction>(Value* leftOperand, Value* rightOperand, Value::DataType resultDataType);
+template Value* Builder::createBinaryOperation<ShiftRightInstruction>(Value* leftOperand, Value* rightOperand, Value::DataType resultDataType);
 
 template <typename T> Value* Builder::createBinaryOperation(Value* leftOperand, Value* rightOperand, Value::DataType resultDataType)
 {
@@ -210,6 +231,17 @@ void Builder::createAssignment(Value* dest, Value* value)
 	_activeBasicBlock->addInstruction(new AssignInstruction(dest, value));
 }
 
+void Builder::createStoreIndexed(Value* array, Value* index, Value* value)
+{
+	if (index->getType() == Value::Type::NAMED)
+		_activeBasicBlock->addUse(index);
+
+	if (value->getType() == Value::Type::NAMED)
+		_activeBasicBlock->addUse(value);
+
+	_activeBasicBlock->addInstruction(new StoreIndexedInstruction(array, index, value));
+}
+
 void Builder::createJump(BasicBlock* destBlock)
 {
 	_activeBasicBlock->addSuccessor(destBlock);
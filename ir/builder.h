@@ -37,10 +37,13 @@ public:
 	Value* createCall(const std::string& functionName, const std::vector<Value*> arguments, bool createValueForResult);
 	Value* createBuiltinCall(const std::string& functionName, ir::Value::DataType returnDataType, const std::vector<Value*> arguments, bool createValueForResult);
 	Value* createDeclaration(const std::string& name, Value::DataType dataType);
+	Value* createArrayDeclaration(const std::string& name, Value::DataType dataType, int arraySize);
+	Value* createLoadIndexed(Value* array, Value* index);
 	template <typename T> Value* createUnaryOperation(Value* operand, Value::DataType resultDataType);
 	template <typename T> Value* createBinaryOperation(Value* leftOperand, Value* rightOperand, Value::DataType resultDataType);
 
 	void createAssignment(Value* dest, Value* value);
+	void createStoreIndexed(Value* array, Value* index, Value* value);
 	void createJump(BasicBlock* destBlock);
 	void createConditionalJump(Value* condition, BasicBlock* ifTrue, BasicBlock* ifFalse);
 	void createReturn(Value* value);
@@ -0,0 +1,189 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#include <map>
+#include "ir/constant_folding.h"
+#include "ir/instruction.h"
+
+namespace ir {
+
+static bool isConstant(Value* value)
+{
+	return value != nullptr && value->getType() == Value::Type::CONSTANT;
+}
+
+template <typename T> static T constantOf(Value* value)
+{
+	return static_cast<ConstantValue<T>*>(value)->getConstantValue();
+}
+
+// Same as $STR_CMP$, characters are compared as signed bytes
+static int compareStrings(const std::string& left, const std::string& right)
+{
+	for (std::size_t i = 0; ; ++i)
+	{
+		signed char l = i < left.length() ? left[i] : '\0';
+		signed char r = i < right.length() ? right[i] : '\0';
+		if (l != r)
+			return l - r;
+		if (l == '\0')
+			return 0;
+	}
+}
+
+ConstantFolding::ConstantFolding()
+{
+}
+
+ConstantFolding::~ConstantFolding()
+{
+}
+
+void ConstantFolding::run(Builder& builder)
+{
+	for (auto& pair : builder.getFunctions())
+	{
+		std::map<Value*, Value*> folded;
+		for (BasicBlock* bb : pair.second->getBasicBlocks())
+		{
+			std::vector<Instruction*>& instructions = bb->getInstructions();
+			for (auto itr = instructions.begin(); itr != instructions.end(); )
+			{
+				for (Value* operand : getInstructionOperands(*itr))
+				{
+					auto foldedItr = folded.find(operand);
+					if (foldedItr != folded.end())
+						replaceInstructionOperand(*itr, operand, foldedItr->second);
+				}
+
+				Value* result = nullptr;
+				if (!_fold(builder, *itr, result))
+				{
+					++itr;
+					continue;
+				}
+
+				// Temporaries are defined only once, so the result can be replaced everywhere
+				ResultInstruction* resultInst = dynamic_cast<ResultInstruction*>(*itr);
+				if (resultInst->getResult() != nullptr)
+					folded[resultInst->getResult()] = result;
+
+				delete *itr;
+				itr = instructions.erase(itr);
+			}
+		}
+	}
+}
+
+bool ConstantFolding::_fold(Builder& builder, Instruction* instruction, Value*& result)
+{
+	if (BuiltinCallInstruction* builtinInst = dynamic_cast<BuiltinCallInstruction*>(instruction))
+		return _foldBuiltinCall(builder, builtinInst, result);
+	else if (TypecastInstruction* castInst = dynamic_cast<TypecastInstruction*>(instruction))
+	{
+		Value* operand = castInst->getOperand();
+		if (!isConstant(operand) || operand->getDataType() != Value::DataType::CHAR || castInst->getResult()->getDataType() != Value::DataType::STRING)
+			return false;
+
+		char c = constantOf<char>(operand);
+		if (c != '\0' && !canEscapeChar(c))
+			return false;
+
+		result = builder.createConstantValue(escapeStringConstant(c == '\0' ? std::string() : std::string(1, c)));
+		return true;
+	}
+	else if (BinaryInstruction* binaryInst = dynamic_cast<BinaryInstruction*>(instruction))
+	{
+		if (binaryInst->getLeftOperand()->getDataType() != Value::DataType::STRING)
+			return false;
+
+		return _foldStringComparison(builder, binaryInst, result);
+	}
+
+	return false;
+}
+
+bool ConstantFolding::_foldBuiltinCall(Builder& builder, BuiltinCallInstruction* instruction, Value*& result)
+{
+	const std::string& name = instruction->getFunctionName();
+	std::vector<Value*>& args = instruction->getArguments();
+	if (name != "strcat" && name != "get_at" && name != "set_at" && name != "strlen" && name != "substr")
+		return false;
+
+	for (Value* arg : args)
+	{
+		if (!isConstant(arg))
+			return false;
+	}
+
+	if (name == "strcat")
+	{
+		// Both are escaped, so they can be simply put together
+		result = builder.createConstantValue(constantOf<std::string>(args[0]) + constantOf<std::string>(args[1]));
+		return true;
+	}
+
+	std::string str = unescapeStringConstant(constantOf<std::string>(args[0]));
+	if (name == "strlen")
+	{
+		result = builder.createConstantValue(static_cast<int>(str.length()));
+		return true;
+	}
+
+	// Indices outside of the string are left for the runtime
+	int index = constantOf<int>(args[1]);
+	if (index < 0 || index > static_cast<int>(str.length()))
+		return false;
+
+	if (name == "get_at")
+	{
+		result = builder.createConstantValue(index == static_cast<int>(str.length()) ? '\0' : str[index]);
+		return true;
+	}
+
+	if (name == "substr")
+	{
+		// Negative length is taken as unsigned, so the rest of the string is used
+		int length = constantOf<int>(args[2]);
+		result = builder.createConstantValue(escapeStringConstant(str.substr(index, length < 0 ? std::string::npos : length)));
+		return true;
+	}
+
+	char c = constantOf<char>(args[2]);
+	if (index == static_cast<int>(str.length()) || (c != '\0' && !canEscapeChar(c)))
+		return false;
+
+	str[index] = c;
+	result = builder.createConstantValue(escapeStringConstant(str.substr(0, str.find('\0'))));
+	return true;
+}
+
+bool ConstantFolding::_foldStringComparison(Builder& builder, BinaryInstruction* instruction, Value*& result)
+{
+	Value* left = instruction->getLeftOperand();
+	Value* right = instruction->getRightOperand();
+	if (!isConstant(left) || !isConstant(right))
+		return false;
+
+	int cmp = compareStrings(unescapeStringConstant(constantOf<std::string>(left)), unescapeStringConstant(constantOf<std::string>(right)));
+	if (dynamic_cast<LessInstruction*>(instruction))
+		result = builder.createConstantValue(cmp < 0 ? 1 : 0);
+	else if (dynamic_cast<LessEqualInstruction*>(instruction))
+		result = builder.createConstantValue(cmp <= 0 ? 1 : 0);
+	else if (dynamic_cast<GreaterInstruction*>(instruction))
+		result = builder.createConstantValue(cmp > 0 ? 1 : 0);
+	else if (dynamic_cast<GreaterEqualInstruction*>(instruction))
+		result = builder.createConstantValue(cmp >= 0 ? 1 : 0);
+	else if (dynamic_cast<EqualInstruction*>(instruction))
+		result = builder.createConstantValue(cmp == 0 ? 1 : 0);
+	else if (dynamic_cast<NotEqualInstruction*>(instruction))
+		result = builder.createConstantValue(cmp != 0 ? 1 : 0);
+	else
+		return false;
+
+	return true;
+}
+
+} // namespace ir
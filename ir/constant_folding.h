@@ -0,0 +1,34 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#ifndef IR_CONSTANT_FOLDING_H
+#define IR_CONSTANT_FOLDING_H
+
+#include "ir/optimizer.h"
+
+namespace ir {
+
+/**
+ * Evaluates string builtins, char to string typecasts and string comparisons
+ * with constant operands at compile time. Folded instruction is removed and
+ * its result is replaced with the computed constant in all following instructions.
+ */
+class ConstantFolding : public Pass
+{
+public:
+	ConstantFolding();
+	virtual ~ConstantFolding();
+
+	virtual void run(Builder& builder) override;
+
+private:
+	bool _fold(Builder& builder, Instruction* instruction, Value*& result);
+	bool _foldBuiltinCall(Builder& builder, BuiltinCallInstruction* instruction, Value*& result);
+	bool _foldStringComparison(Builder& builder, BinaryInstruction* instruction, Value*& result);
+};
+
+} // namespace ir
+
+#endif // IR_CONSTANT_FOLDING_H
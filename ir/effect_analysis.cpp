@@ -0,0 +1,218 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#include <deque>
+#include <set>
+#include "ir/effect_analysis.h"
+#include "ir/instruction.h"
+
+namespace ir {
+
+FunctionEffects::FunctionEffects() : allocates(false), readsInput(false), printsOutput(false), returnsBorrowedString(false)
+{
+}
+
+bool FunctionEffects::operator==(const FunctionEffects& other) const
+{
+	return allocates == other.allocates && readsInput == other.readsInput && printsOutput == other.printsOutput
+		&& returnsBorrowedString == other.returnsBorrowedString;
+}
+
+bool FunctionEffects::operator!=(const FunctionEffects& other) const
+{
+	return !(*this == other);
+}
+
+EffectAnalysis::EffectAnalysis() : _effects(), _unknownEffects()
+{
+	// Functions we know nothing about are expected to do everything
+	_unknownEffects.allocates = true;
+	_unknownEffects.readsInput = true;
+	_unknownEffects.printsOutput = true;
+	_unknownEffects.returnsBorrowedString = false;
+}
+
+EffectAnalysis::~EffectAnalysis()
+{
+}
+
+void EffectAnalysis::run(Builder& builder)
+{
+	_effects.clear();
+
+	// Build reversed call graph, so we know whom to revisit when summary of callee changes
+	std::map<Function*, std::set<Function*>> callers;
+	for (auto& pair : builder.getFunctions())
+	{
+		// Doesn't depend on callees, so it is known before the other effects
+		_effects[pair.second] = FunctionEffects();
+		_effects[pair.second].returnsBorrowedString = _computeReturnsBorrowedString(pair.second);
+		for (BasicBlock* bb : pair.second->getBasicBlocks())
+		{
+			for (Instruction* inst : bb->getInstructions())
+			{
+				if (CallInstruction* callInst = dynamic_cast<CallInstruction*>(inst))
+					callers[callInst->getFunction()].insert(pair.second);
+			}
+		}
+	}
+
+	// Summaries only grow, so this always terminates, even with recursion
+	std::deque<Function*> worklist;
+	std::set<Function*> queued;
+	for (auto& pair : builder.getFunctions())
+	{
+		worklist.push_back(pair.second);
+		queued.insert(pair.second);
+	}
+
+	while (!worklist.empty())
+	{
+		Function* function = worklist.front();
+		worklist.pop_front();
+		queued.erase(function);
+
+		FunctionEffects effects = _computeEffects(function);
+		if (effects == _effects[function])
+			continue;
+
+		_effects[function] = effects;
+		for (Function* caller : callers[function])
+		{
+			if (queued.insert(caller).second)
+				worklist.push_back(caller);
+		}
+	}
+}
+
+const FunctionEffects& EffectAnalysis::getEffects(Function* function) const
+{
+	auto itr = _effects.find(function);
+	if (itr == _effects.end())
+		return _unknownEffects;
+
+	return itr->second;
+}
+
+bool EffectAnalysis::allocates(Function* function) const
+{
+	return getEffects(function).allocates;
+}
+
+bool EffectAnalysis::readsInput(Function* function) const
+{
+	return getEffects(function).readsInput;
+}
+
+bool EffectAnalysis::printsOutput(Function* function) const
+{
+	return getEffects(function).printsOutput;
+}
+
+bool EffectAnalysis::returnsBorrowedString(Function* function) const
+{
+	return getEffects(function).returnsBorrowedString;
+}
+
+bool EffectAnalysis::allocates(Instruction* instruction) const
+{
+	if (CallInstruction* callInst = dynamic_cast<CallInstruction*>(instruction))
+	{
+		// Returned string is copied or adopted into caller's heap
+		return callInst->getResult() != nullptr && callInst->getFunction()->getReturnDataType() == Value::DataType::STRING
+			&& !returnsBorrowedString(callInst->getFunction());
+	}
+	else if (BuiltinCallInstruction* builtinInst = dynamic_cast<BuiltinCallInstruction*>(instruction))
+	{
+		const std::string& name = builtinInst->getFunctionName();
+		if (name == "read_string" || name == "strcat" || name == "set_at" || name == "substr")
+			return builtinInst->getResult() != nullptr;
+	}
+	else if (TypecastInstruction* castInst = dynamic_cast<TypecastInstruction*>(instruction))
+	{
+		return castInst->getOperand()->getDataType() == Value::DataType::CHAR && castInst->getResult()->getDataType() == Value::DataType::STRING;
+	}
+
+	return false;
+}
+
+FunctionEffects EffectAnalysis::_computeEffects(Function* function) const
+{
+	FunctionEffects effects;
+	effects.returnsBorrowedString = _effects.at(function).returnsBorrowedString;
+	for (BasicBlock* bb : function->getBasicBlocks())
+	{
+		for (Instruction* inst : bb->getInstructions())
+		{
+			if (allocates(inst))
+				effects.allocates = true;
+
+			if (CallInstruction* callInst = dynamic_cast<CallInstruction*>(inst))
+			{
+				const FunctionEffects& calleeEffects = getEffects(callInst->getFunction());
+				effects.readsInput |= calleeEffects.readsInput;
+				effects.printsOutput |= calleeEffects.printsOutput;
+			}
+			else if (BuiltinCallInstruction* builtinInst = dynamic_cast<BuiltinCallInstruction*>(inst))
+			{
+				const std::string& name = builtinInst->getFunctionName();
+				if (name == "print")
+					effects.printsOutput = true;
+				else if (name == "read_char" || name == "read_int" || name == "read_string")
+					effects.readsInput = true;
+			}
+		}
+	}
+
+	return effects;
+}
+
+bool EffectAnalysis::_computeReturnsBorrowedString(Function* function) const
+{
+	if (function->getReturnDataType() != Value::DataType::STRING)
+		return false;
+
+	// Find all values which may hold string allocated by this function, everything else
+	// is either constant or parameter, which both live below the $gp of the caller
+	std::set<Value*> fresh;
+	std::vector<AssignInstruction*> assigns;
+	std::vector<ReturnInstruction*> returns;
+	for (BasicBlock* bb : function->getBasicBlocks())
+	{
+		for (Instruction* inst : bb->getInstructions())
+		{
+			if (AssignInstruction* assignInst = dynamic_cast<AssignInstruction*>(inst))
+				assigns.push_back(assignInst);
+			else if (ReturnInstruction* retInst = dynamic_cast<ReturnInstruction*>(inst))
+				returns.push_back(retInst);
+			else if (ResultInstruction* resultInst = dynamic_cast<ResultInstruction*>(inst))
+			{
+				if (resultInst->getResult() != nullptr && resultInst->getResult()->getDataType() == Value::DataType::STRING)
+					fresh.insert(resultInst->getResult());
+			}
+		}
+	}
+
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+		for (AssignInstruction* assignInst : assigns)
+		{
+			if (fresh.find(assignInst->getOperand()) != fresh.end())
+				changed |= fresh.insert(assignInst->getResult()).second;
+		}
+	}
+
+	for (ReturnInstruction* retInst : returns)
+	{
+		if (retInst->getOperand() != nullptr && fresh.find(retInst->getOperand()) != fresh.end())
+			return false;
+	}
+
+	return true;
+}
+
+} // namespace ir
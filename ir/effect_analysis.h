@@ -0,0 +1,67 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#ifndef IR_EFFECT_ANALYSIS_H
+#define IR_EFFECT_ANALYSIS_H
+
+#include <map>
+#include "ir/builder.h"
+#include "ir/function.h"
+
+namespace ir {
+
+/**
+ * Summary of side effects of a single function.
+ *
+ * allocates    - function returns with $gp moved, i.e. it creates strings on the heap.
+ *                Calls to allocating functions are not counted, caller always restores
+ *                $gp after such call, so the allocation is not visible outside.
+ * readsInput   - function or any of its callees reads from the input.
+ * printsOutput - function or any of its callees prints to the output.
+ * returnsBorrowedString - returned string always lives in the memory of the caller
+ *                (string constant or unmodified parameter), so caller does not need
+ *                to copy it into its own heap.
+ */
+struct FunctionEffects
+{
+	FunctionEffects();
+
+	bool operator==(const FunctionEffects& other) const;
+	bool operator!=(const FunctionEffects& other) const;
+
+	bool allocates;
+	bool readsInput;
+	bool printsOutput;
+	bool returnsBorrowedString;
+};
+
+class EffectAnalysis
+{
+public:
+	EffectAnalysis();
+	~EffectAnalysis();
+
+	void run(Builder& builder);
+
+	const FunctionEffects& getEffects(Function* function) const;
+
+	bool allocates(Function* function) const;
+	bool readsInput(Function* function) const;
+	bool printsOutput(Function* function) const;
+	bool returnsBorrowedString(Function* function) const;
+
+	bool allocates(Instruction* instruction) const;
+
+private:
+	FunctionEffects _computeEffects(Function* function) const;
+	bool _computeReturnsBorrowedString(Function* function) const;
+
+	std::map<Function*, FunctionEffects> _effects;
+	FunctionEffects _unknownEffects;
+};
+
+} // namespace ir
+
+#endif // IR_EFFECT_ANALYSIS_H
@@ -0,0 +1,245 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#include "ir/in_place_update.h"
+#include "ir/instruction.h"
+#include "ir/builder.h"
+
+namespace ir {
+
+InPlaceUpdate::InPlaceUpdate(bool ropeStrings) : _ropeStrings(ropeStrings), _liveness(), _aliasParent(), _fromCaller(), _maybeConstant()
+{
+}
+
+InPlaceUpdate::~InPlaceUpdate()
+{
+}
+
+void InPlaceUpdate::run(Builder& builder)
+{
+	for (auto& pair : builder.getFunctions())
+	{
+		Function* function = pair.second;
+		_liveness.run(function);
+		_buildAliasClasses(function);
+
+		for (BasicBlock* bb : function->getBasicBlocks())
+		{
+			for (Instruction* inst : bb->getInstructions())
+			{
+				BuiltinCallInstruction* builtinInst = dynamic_cast<BuiltinCallInstruction*>(inst);
+				if (builtinInst != nullptr && builtinInst->getFunctionName() == "set_at" && builtinInst->getResult() != nullptr)
+					_markInPlace(builtinInst);
+			}
+		}
+
+		if (!_ropeStrings)
+			_markAppends(builder, function);
+	}
+}
+
+void InPlaceUpdate::_buildAliasClasses(Function* function)
+{
+	_aliasParent.clear();
+	_fromCaller.clear();
+	_maybeConstant.clear();
+
+	// Values which may hold the same string end up in the same class
+	for (BasicBlock* bb : function->getBasicBlocks())
+	{
+		for (Instruction* inst : bb->getInstructions())
+		{
+			if (AssignInstruction* assignInst = dynamic_cast<AssignInstruction*>(inst))
+			{
+				if (assignInst->getResult()->getDataType() == Value::DataType::STRING)
+					_union(assignInst->getResult(), assignInst->getOperand());
+			}
+			else if (CallInstruction* callInst = dynamic_cast<CallInstruction*>(inst))
+			{
+				// Callee may return any of its string arguments
+				Value* result = callInst->getResult();
+				if (result == nullptr || result->getDataType() != Value::DataType::STRING)
+					continue;
+
+				_maybeConstant[result] = true;
+				for (Value* arg : callInst->getArguments())
+				{
+					if (arg->getDataType() == Value::DataType::STRING)
+						_union(result, arg);
+				}
+			}
+			else if (BuiltinCallInstruction* builtinInst = dynamic_cast<BuiltinCallInstruction*>(inst))
+			{
+				if (builtinInst->getFunctionName() == "set_at" && builtinInst->getResult() != nullptr)
+					_union(builtinInst->getResult(), builtinInst->getArguments()[0]);
+				else if (_ropeStrings && builtinInst->getFunctionName() == "strcat" && builtinInst->getResult() != nullptr)
+				{
+					_union(builtinInst->getResult(), builtinInst->getArguments()[0]);
+					_union(builtinInst->getResult(), builtinInst->getArguments()[1]);
+				}
+			}
+		}
+	}
+
+	for (Value* param : function->getParameters())
+	{
+		if (param->getDataType() == Value::DataType::STRING)
+			_fromCaller[_find(param)] = true;
+	}
+
+	for (auto& pair : _aliasParent)
+	{
+		if (pair.first->getType() == Value::Type::CONSTANT || _maybeConstant[pair.first])
+			_maybeConstant[_find(pair.first)] = true;
+	}
+}
+
+void InPlaceUpdate::_markInPlace(BuiltinCallInstruction* instruction)
+{
+	Value* source = instruction->getArguments()[0];
+	Value* sourceClass = _find(source);
+	if (source->getType() == Value::Type::CONSTANT || _fromCaller[sourceClass])
+		return;
+
+	// Result takes over the string, so only the result may point to it afterwards
+	for (Value* live : _liveness.getLiveAfter(instruction))
+	{
+		if (live != instruction->getResult() && _find(live) == sourceClass)
+			return;
+	}
+
+	instruction->setInPlace(_maybeConstant[sourceClass] ? BuiltinCallInstruction::InPlace::HEAP_ONLY : BuiltinCallInstruction::InPlace::ALWAYS);
+}
+
+void InPlaceUpdate::_markAppends(Builder& builder, Function* function)
+{
+	std::map<Value*, Value*> appendEnds;
+	for (BasicBlock* bb : function->getBasicBlocks())
+	{
+		if (!_isInLoop(bb))
+			continue;
+
+		std::vector<Instruction*>& instructions = bb->getInstructions();
+		for (size_t i = 0; i + 1 < instructions.size(); ++i)
+		{
+			BuiltinCallInstruction* builtinInst = dynamic_cast<BuiltinCallInstruction*>(instructions[i]);
+			if (builtinInst == nullptr || !_isAppend(builtinInst, instructions[i + 1]))
+				continue;
+
+			Value* accumulator = builtinInst->getArguments()[0];
+			Value*& appendEnd = appendEnds[accumulator];
+			if (appendEnd == nullptr)
+				appendEnd = builder.createNamedValue(Value::DataType::INT, static_cast<NamedValue*>(accumulator)->getName() + "$end");
+			builtinInst->setAppendEnd(appendEnd);
+		}
+	}
+
+	if (appendEnds.empty())
+		return;
+
+	// End is valid only for the string created by the append, any other assignment invalidates it
+	Value* invalidEnd = builder.createConstantValue(0);
+	for (BasicBlock* bb : function->getBasicBlocks())
+	{
+		std::vector<Instruction*>& instructions = bb->getInstructions();
+		for (size_t i = 0; i < instructions.size(); ++i)
+		{
+			Value* def = Liveness::getDefinedValue(instructions[i]);
+			auto itr = appendEnds.find(def);
+			if (itr == appendEnds.end())
+				continue;
+
+			BuiltinCallInstruction* builtinInst = i > 0 ? dynamic_cast<BuiltinCallInstruction*>(instructions[i - 1]) : nullptr;
+			if (builtinInst != nullptr && builtinInst->getAppendEnd() == itr->second)
+				continue;
+
+			instructions.insert(instructions.begin() + i + 1, new AssignInstruction(itr->second, invalidEnd));
+			++i;
+		}
+	}
+
+	BasicBlock* entry = function->getEntryBasicBlock();
+	std::vector<Instruction*>& entryInstructions = entry->getInstructions();
+	for (auto& pair : appendEnds)
+	{
+		entry->addDef(pair.second);
+		entryInstructions.insert(entryInstructions.begin(), new AssignInstruction(pair.second, invalidEnd));
+		entryInstructions.insert(entryInstructions.begin(), new DeclarationInstruction(pair.second));
+	}
+}
+
+bool InPlaceUpdate::_isAppend(BuiltinCallInstruction* instruction, Instruction* nextInstruction)
+{
+	if (instruction->getFunctionName() != "strcat" || instruction->getResult() == nullptr)
+		return false;
+
+	// Result has to be immediately assigned back to the named variable it was appended to
+	Value* accumulator = instruction->getArguments()[0];
+	AssignInstruction* assignInst = dynamic_cast<AssignInstruction*>(nextInstruction);
+	if (accumulator->getType() != Value::Type::NAMED || assignInst == nullptr
+			|| assignInst->getOperand() != instruction->getResult() || assignInst->getResult() != accumulator)
+		return false;
+
+	// Copying the string to its own end would never find the terminator
+	Value* accumulatorClass = _find(accumulator);
+	if (_find(instruction->getArguments()[1]) == accumulatorClass)
+		return false;
+
+	// Appended string is changed, so nothing else may point to it afterwards
+	for (Value* live : _liveness.getLiveAfter(instruction))
+	{
+		if (live != instruction->getResult() && _find(live) == accumulatorClass)
+			return false;
+	}
+
+	return true;
+}
+
+bool InPlaceUpdate::_isInLoop(BasicBlock* basicBlock)
+{
+	std::set<BasicBlock*> visited;
+	std::vector<BasicBlock*> stack(basicBlock->getSuccessors().begin(), basicBlock->getSuccessors().end());
+	while (!stack.empty())
+	{
+		BasicBlock* bb = stack.back();
+		stack.pop_back();
+		if (bb == basicBlock)
+			return true;
+
+		if (!visited.insert(bb).second)
+			continue;
+
+		stack.insert(stack.end(), bb->getSuccessors().begin(), bb->getSuccessors().end());
+	}
+
+	return false;
+}
+
+Value* InPlaceUpdate::_find(Value* value)
+{
+	auto itr = _aliasParent.find(value);
+	if (itr == _aliasParent.end())
+	{
+		_aliasParent[value] = value;
+		return value;
+	}
+
+	if (itr->second == value)
+		return value;
+
+	Value* root = _find(itr->second);
+	_aliasParent[value] = root;
+	return root;
+}
+
+void InPlaceUpdate::_union(Value* value1, Value* value2)
+{
+	Value* root1 = _find(value1);
+	Value* root2 = _find(value2);
+	if (root1 != root2)
+		_aliasParent[root1] = root2;
+}
+
+} // namespace ir
@@ -0,0 +1,55 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#ifndef IR_IN_PLACE_UPDATE_H
+#define IR_IN_PLACE_UPDATE_H
+
+#include <map>
+#include "ir/liveness.h"
+#include "ir/optimizer.h"
+
+namespace ir {
+
+/**
+ * Marks set_at calls which may store the character directly into the source string.
+ * Source string must be dead after the call and nothing else which is still live may
+ * point to the same string. Strings which may come from the caller are never modified,
+ * string constants are detected at runtime.
+ *
+ * Accumulators updated as s = strcat(s, x) in a loop get hidden variable with the end
+ * of the string built by the last append. While nothing else is allocated on the heap,
+ * the next append only overwrites the terminator and copies x.
+ *
+ * Rope strings refer to the operands of strcat, so its result aliases them and
+ * accumulators are not needed.
+ */
+class InPlaceUpdate : public Pass
+{
+public:
+	InPlaceUpdate(bool ropeStrings);
+	virtual ~InPlaceUpdate();
+
+	virtual void run(Builder& builder) override;
+
+private:
+	void _buildAliasClasses(Function* function);
+	void _markInPlace(BuiltinCallInstruction* instruction);
+	void _markAppends(Builder& builder, Function* function);
+	bool _isAppend(BuiltinCallInstruction* instruction, Instruction* nextInstruction);
+	bool _isInLoop(BasicBlock* basicBlock);
+
+	Value* _find(Value* value);
+	void _union(Value* value1, Value* value2);
+
+	bool _ropeStrings;
+	Liveness _liveness;
+	std::map<Value*, Value*> _aliasParent;
+	std::map<Value*, bool> _fromCaller;
+	std::map<Value*, bool> _maybeConstant;
+};
+
+} // namespace ir
+
+#endif // IR_IN_PLACE_UPDATE_H
@@ -32,6 +32,11 @@ Value* UnaryInstruction::getOperand()
 	return _operand;
 }
 
+void UnaryInstruction::setOperand(Value* operand)
+{
+	_operand = operand;
+}
+
 BinaryInstruction::BinaryInstruction(Value* leftOperand, Value* rightOperand) : _leftOperand(leftOperand), _rightOperand(rightOperand)
 {
 }
@@ -50,6 +55,16 @@ Value* BinaryInstruction::getRightOperand()
 	return _rightOperand;
 }
 
+void BinaryInstruction::setLeftOperand(Value* leftOperand)
+{
+	_leftOperand = leftOperand;
+}
+
+void BinaryInstruction::setRightOperand(Value* rightOperand)
+{
+	_rightOperand = rightOperand;
+}
+
 ResultInstruction::ResultInstruction(Value* result) : _result(result)
 {
 }
@@ -121,6 +136,11 @@ Value* CondJumpInstruction::getCondition()
 	return _condition;
 }
 
+void CondJumpInstruction::setCondition(Value* condition)
+{
+	_condition = condition;
+}
+
 BasicBlock* CondJumpInstruction::getTrueBasicBlock()
 {
 	return _trueBasicBlock;
@@ -174,7 +194,7 @@ void CallInstruction::accept(IrVisitor& visitor)
 }
 
 BuiltinCallInstruction::BuiltinCallInstruction(Value* returnValue, const std::string& functionName, const std::vector<Value*>& arguments)
-	: ResultInstruction(returnValue), _functionName(functionName), _arguments(arguments)
+	: ResultInstruction(returnValue), _functionName(functionName), _arguments(arguments), _inPlace(InPlace::NEVER), _appendEnd(nullptr)
 {
 }
 
@@ -192,11 +212,98 @@ std::vector<Value*>& BuiltinCallInstruction::getArguments()
 	return _arguments;
 }
 
+BuiltinCallInstruction::InPlace BuiltinCallInstruction::getInPlace() const
+{
+	return _inPlace;
+}
+
+void BuiltinCallInstruction::setInPlace(InPlace inPlace)
+{
+	_inPlace = inPlace;
+}
+
+Value* BuiltinCallInstruction::getAppendEnd() const
+{
+	return _appendEnd;
+}
+
+void BuiltinCallInstruction::setAppendEnd(Value* appendEnd)
+{
+	_appendEnd = appendEnd;
+}
+
 void BuiltinCallInstruction::accept(IrVisitor& visitor)
 {
 	visitor.visit(this);
 }
 
+LoadIndexedInstruction::LoadIndexedInstruction(Value* result, Value* array, Value* index) : ResultInstruction(result),
+	_array(array), _index(index)
+{
+}
+
+LoadIndexedInstruction::~LoadIndexedInstruction()
+{
+}
+
+void LoadIndexedInstruction::accept(IrVisitor& visitor)
+{
+	visitor.visit(this);
+}
+
+Value* LoadIndexedInstruction::getArray()
+{
+	return _array;
+}
+
+Value* LoadIndexedInstruction::getIndex()
+{
+	return _index;
+}
+
+void LoadIndexedInstruction::setIndex(Value* index)
+{
+	_index = index;
+}
+
+StoreIndexedInstruction::StoreIndexedInstruction(Value* array, Value* index, Value* value) : _array(array), _index(index), _value(value)
+{
+}
+
+StoreIndexedInstruction::~StoreIndexedInstruction()
+{
+}
+
+void StoreIndexedInstruction::accept(IrVisitor& visitor)
+{
+	visitor.visit(this);
+}
+
+Value* StoreIndexedInstruction::getArray()
+{
+	return _array;
+}
+
+Value* StoreIndexedInstruction::getIndex()
+{
+	return _index;
+}
+
+Value* StoreIndexedInstruction::getValue()
+{
+	return _value;
+}
+
+void StoreIndexedInstruction::setIndex(Value* index)
+{
+	_index = index;
+}
+
+void StoreIndexedInstruction::setValue(Value* value)
+{
+	_value = value;
+}
+
 AddInstruction::AddInstruction(Value* result, Value* leftOperand, Value* rightOperand) : ResultInstruction(result), BinaryInstruction(leftOperand, rightOperand)
 {
 }
@@ -392,6 +499,45 @@ void BitwiseOrInstruction::accept(IrVisitor& visitor)
 	visitor.visit(this);
 }
 
+BitwiseXorInstruction::BitwiseXorInstruction(Value* result, Value* leftOperand, Value* rightOperand) : ResultInstruction(result), BinaryInstruction(leftOperand, rightOperand)
+{
+}
+
+BitwiseXorInstruction::~BitwiseXorInstruction()
+{
+}
+
+void BitwiseXorInstruction::accept(IrVisitor& visitor)
+{
+	visitor.visit(this);
+}
+
+ShiftLeftInstruction::ShiftLeftInstruction(Value* result, Value* leftOperand, Value* rightOperand) : ResultInstruction(result), BinaryInstruction(leftOperand, rightOperand)
+{
+}
+
+ShiftLeftInstruction::~ShiftLeftInstruction()
+{
+}
+
+void ShiftLeftInstruction::accept(IrVisitor& visitor)
+{
+	visitor.visit(this);
+}
+
+ShiftRightInstruction::ShiftRightInstruction(Value* result, Value* leftOperand, Value* rightOperand) : ResultInstruction(result), BinaryInstruction(leftOperand, rightOperand)
+{
+}
+
+ShiftRightInstruction::~ShiftRightInstruction()
+{
+}
+
+void ShiftRightInstruction::accept(IrVisitor& visitor)
+{
+	visitor.visit(this);
+}
+
 NotInstruction::NotInstruction(Value* result, Value* operand) : ResultInstruction(result), UnaryInstruction(operand)
 {
 }
@@ -444,4 +590,91 @@ void NegInstruction::accept(IrVisitor& visitor)
 	visitor.visit(this);
 }
 
+std::vector<Value*> getInstructionOperands(Instruction* instruction)
+{
+	std::vector<Value*> operands;
+	if (dynamic_cast<DeclarationInstruction*>(instruction) != nullptr)
+		return operands;
+
+	if (UnaryInstruction* unaryInst = dynamic_cast<UnaryInstruction*>(instruction))
+	{
+		if (unaryInst->getOperand() != nullptr)
+			operands.push_back(unaryInst->getOperand());
+	}
+	else if (BinaryInstruction* binaryInst = dynamic_cast<BinaryInstruction*>(instruction))
+	{
+		operands.push_back(binaryInst->getLeftOperand());
+		operands.push_back(binaryInst->getRightOperand());
+	}
+	else if (CondJumpInstruction* condJumpInst = dynamic_cast<CondJumpInstruction*>(instruction))
+		operands.push_back(condJumpInst->getCondition());
+	else if (CallInstruction* callInst = dynamic_cast<CallInstruction*>(instruction))
+		operands = callInst->getArguments();
+	else if (BuiltinCallInstruction* builtinInst = dynamic_cast<BuiltinCallInstruction*>(instruction))
+	{
+		operands = builtinInst->getArguments();
+		if (builtinInst->getAppendEnd() != nullptr)
+			operands.push_back(builtinInst->getAppendEnd());
+	}
+	else if (LoadIndexedInstruction* loadInst = dynamic_cast<LoadIndexedInstruction*>(instruction))
+		operands.push_back(loadInst->getIndex());
+	else if (StoreIndexedInstruction* storeInst = dynamic_cast<StoreIndexedInstruction*>(instruction))
+	{
+		operands.push_back(storeInst->getIndex());
+		operands.push_back(storeInst->getValue());
+	}
+
+	return operands;
+}
+
+void replaceInstructionOperand(Instruction* instruction, Value* oldValue, Value* newValue)
+{
+	if (dynamic_cast<DeclarationInstruction*>(instruction) != nullptr)
+		return;
+
+	std::vector<Value*>* arguments = nullptr;
+	if (UnaryInstruction* unaryInst = dynamic_cast<UnaryInstruction*>(instruction))
+	{
+		if (unaryInst->getOperand() == oldValue)
+			unaryInst->setOperand(newValue);
+	}
+	else if (BinaryInstruction* binaryInst = dynamic_cast<BinaryInstruction*>(instruction))
+	{
+		if (binaryInst->getLeftOperand() == oldValue)
+			binaryInst->setLeftOperand(newValue);
+		if (binaryInst->getRightOperand() == oldValue)
+			binaryInst->setRightOperand(newValue);
+	}
+	else if (CondJumpInstruction* condJumpInst = dynamic_cast<CondJumpInstruction*>(instruction))
+	{
+		if (condJumpInst->getCondition() == oldValue)
+			condJumpInst->setCondition(newValue);
+	}
+	else if (CallInstruction* callInst = dynamic_cast<CallInstruction*>(instruction))
+		arguments = &callInst->getArguments();
+	else if (BuiltinCallInstruction* builtinInst = dynamic_cast<BuiltinCallInstruction*>(instruction))
+		arguments = &builtinInst->getArguments();
+	else if (LoadIndexedInstruction* loadInst = dynamic_cast<LoadIndexedInstruction*>(instruction))
+	{
+		if (loadInst->getIndex() == oldValue)
+			loadInst->setIndex(newValue);
+	}
+	else if (StoreIndexedInstruction* storeInst = dynamic_cast<StoreIndexedInstruction*>(instruction))
+	{
+		if (storeInst->getIndex() == oldValue)
+			storeInst->setIndex(newValue);
+		if (storeInst->getValue() == oldValue)
+			storeInst->setValue(newValue);
+	}
+
+	if (arguments != nullptr)
+	{
+		for (Value*& arg : *arguments)
+		{
+			if (arg == oldValue)
+				arg = newValue;
+		}
+	}
+}
+
 } // namespace ir
@@ -32,6 +32,7 @@ public:
 	virtual ~UnaryInstruction();
 
 	Value* getOperand();
+	void setOperand(Value* operand);
 
 private:
 	Value* _operand;
@@ -45,6 +46,8 @@ public:
 
 	Value* getLeftOperand();
 	Value* getRightOperand();
+	void setLeftOperand(Value* leftOperand);
+	void setRightOperand(Value* rightOperand);
 
 private:
 	Value* _leftOperand;
@@ -104,6 +107,7 @@ public:
 	virtual void accept(IrVisitor& visitor) override;
 
 	Value* getCondition();
+	void setCondition(Value* condition);
 	BasicBlock* getTrueBasicBlock();
 	BasicBlock* getFalseBasicBlock();
 
@@ -141,6 +145,17 @@ private:
 class BuiltinCallInstruction : public ResultInstruction
 {
 public:
+	/**
+	 * Whether the builtin may modify its string argument instead of creating a copy.
+	 * HEAP_ONLY means the argument may also be a string constant, which can't be modified.
+	 */
+	enum class InPlace
+	{
+		NEVER,
+		ALWAYS,
+		HEAP_ONLY
+	};
+
 	BuiltinCallInstruction(Value* result, const std::string& functionName, const std::vector<Value*>& arguments);
 	virtual ~BuiltinCallInstruction();
 
@@ -149,9 +164,65 @@ public:
 	const std::string& getFunctionName() const;
 	std::vector<Value*>& getArguments();
 
+	InPlace getInPlace() const;
+	void setInPlace(InPlace inPlace);
+
+	/**
+	 * Variable holding the end of the string last built by appending to the first argument
+	 * of strcat. If it still matches the top of the heap, strcat appends in place.
+	 */
+	Value* getAppendEnd() const;
+	void setAppendEnd(Value* appendEnd);
+
 private:
 	std::string _functionName;
 	std::vector<Value*> _arguments;
+	InPlace _inPlace;
+	Value* _appendEnd;
+};
+
+/**
+ * Loads element of the local array at the given index. Array itself is not
+ * considered to be an operand, only the index is.
+ */
+class LoadIndexedInstruction : public ResultInstruction
+{
+public:
+	LoadIndexedInstruction(Value* result, Value* array, Value* index);
+	virtual ~LoadIndexedInstruction();
+
+	virtual void accept(IrVisitor& visitor) override;
+
+	Value* getArray();
+	Value* getIndex();
+	void setIndex(Value* index);
+
+private:
+	Value* _array;
+	Value* _index;
+};
+
+/**
+ * Stores value into the element of the local array at the given index.
+ */
+class StoreIndexedInstruction : public Instruction
+{
+public:
+	StoreIndexedInstruction(Value* array, Value* index, Value* value);
+	virtual ~StoreIndexedInstruction();
+
+	virtual void accept(IrVisitor& visitor) override;
+
+	Value* getArray();
+	Value* getIndex();
+	Value* getValue();
+	void setIndex(Value* index);
+	void setValue(Value* value);
+
+private:
+	Value* _array;
+	Value* _index;
+	Value* _value;
 };
 
 class AddInstruction : public ResultInstruction, public BinaryInstruction
@@ -289,6 +360,33 @@ public:
 	virtual void accept(IrVisitor& visitor) override;
 };
 
+class BitwiseXorInstruction : public ResultInstruction, public BinaryInstruction
+{
+public:
+	BitwiseXorInstruction(Value* result, Value* leftOperand, Value* rightOperand);
+	virtual ~BitwiseXorInstruction();
+
+	virtual void accept(IrVisitor& visitor) override;
+};
+
+class ShiftLeftInstruction : public ResultInstruction, public BinaryInstruction
+{
+public:
+	ShiftLeftInstruction(Value* result, Value* leftOperand, Value* rightOperand);
+	virtual ~ShiftLeftInstruction();
+
+	virtual void accept(IrVisitor& visitor) override;
+};
+
+class ShiftRightInstruction : public ResultInstruction, public BinaryInstruction
+{
+public:
+	ShiftRightInstruction(Value* result, Value* leftOperand, Value* rightOperand);
+	virtual ~ShiftRightInstruction();
+
+	virtual void accept(IrVisitor& visitor) override;
+};
+
 class NotInstruction : public ResultInstruction, public UnaryInstruction
 {
 public:
@@ -325,6 +423,18 @@ public:
 	virtual void accept(IrVisitor& visitor) override;
 };
 
+/**
+ * Values read by the instruction, in the order of evaluation. Declared variable
+ * of DeclarationInstruction and arrays of indexed loads and stores are not
+ * considered to be read.
+ */
+std::vector<Value*> getInstructionOperands(Instruction* instruction);
+
+/**
+ * Replaces all reads of oldValue in the instruction with newValue.
+ */
+void replaceInstructionOperand(Instruction* instruction, Value* oldValue, Value* newValue);
+
 } // namespace ir
 
 #endif // IR_INSTRUCTION_H
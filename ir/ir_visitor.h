@@ -30,6 +30,8 @@ public:
 	virtual void visit(ReturnInstruction* instr) = 0;
 	virtual void visit(CallInstruction* instr) = 0;
 	virtual void visit(BuiltinCallInstruction* instr) = 0;
+	virtual void visit(LoadIndexedInstruction* instr) = 0;
+	virtual void visit(StoreIndexedInstruction* instr) = 0;
 	virtual void visit(AddInstruction* instr) = 0;
 	virtual void visit(SubtractInstruction* instr) = 0;
 	virtual void visit(MultiplyInstruction* instr) = 0;
@@ -45,6 +47,9 @@ public:
 	virtual void visit(OrInstruction* instr) = 0;
 	virtual void visit(BitwiseAndInstruction* instr) = 0;
 	virtual void visit(BitwiseOrInstruction* instr) = 0;
+	virtual void visit(BitwiseXorInstruction* instr) = 0;
+	virtual void visit(ShiftLeftInstruction* instr) = 0;
+	virtual void visit(ShiftRightInstruction* instr) = 0;
 	virtual void visit(NotInstruction* instr) = 0;
 	virtual void visit(TypecastInstruction* instr) = 0;
 	virtual void visit(BitwiseNotInstruction* instr) = 0;
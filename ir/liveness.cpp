@@ -0,0 +1,104 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#include "ir/instruction.h"
+#include "ir/liveness.h"
+
+namespace ir {
+
+Liveness::Liveness() : _liveIn(), _liveOut(), _liveAfter(), _empty()
+{
+}
+
+Liveness::~Liveness()
+{
+}
+
+void Liveness::run(Function* function)
+{
+	_liveIn.clear();
+	_liveOut.clear();
+	_liveAfter.clear();
+
+	std::vector<BasicBlock*>& blocks = function->getBasicBlocks();
+	bool changed = true;
+	while (changed)
+	{
+		changed = false;
+
+		// Blocks are mostly ordered as in the source, backward iteration converges faster
+		for (auto itr = blocks.rbegin(); itr != blocks.rend(); ++itr)
+		{
+			BasicBlock* bb = *itr;
+			std::set<Value*> live;
+			for (BasicBlock* succ : bb->getSuccessors())
+				live.insert(_liveIn[succ].begin(), _liveIn[succ].end());
+			_liveOut[bb] = live;
+
+			std::vector<Instruction*>& instructions = bb->getInstructions();
+			for (auto instItr = instructions.rbegin(); instItr != instructions.rend(); ++instItr)
+			{
+				_liveAfter[*instItr] = live;
+
+				Value* def = getDefinedValue(*instItr);
+				if (def != nullptr)
+					live.erase(def);
+
+				for (Value* operand : getInstructionOperands(*instItr))
+				{
+					if (isVariable(operand))
+						live.insert(operand);
+				}
+			}
+
+			if (live != _liveIn[bb])
+			{
+				_liveIn[bb] = live;
+				changed = true;
+			}
+		}
+	}
+}
+
+const std::set<Value*>& Liveness::getLiveIn(BasicBlock* basicBlock) const
+{
+	auto itr = _liveIn.find(basicBlock);
+	return itr == _liveIn.end() ? _empty : itr->second;
+}
+
+const std::set<Value*>& Liveness::getLiveOut(BasicBlock* basicBlock) const
+{
+	auto itr = _liveOut.find(basicBlock);
+	return itr == _liveOut.end() ? _empty : itr->second;
+}
+
+const std::set<Value*>& Liveness::getLiveAfter(Instruction* instruction) const
+{
+	auto itr = _liveAfter.find(instruction);
+	return itr == _liveAfter.end() ? _empty : itr->second;
+}
+
+bool Liveness::isLiveAfter(Instruction* instruction, Value* value) const
+{
+	const std::set<Value*>& live = getLiveAfter(instruction);
+	return live.find(value) != live.end();
+}
+
+bool Liveness::isVariable(Value* value)
+{
+	return value != nullptr && value->getType() != Value::Type::CONSTANT;
+}
+
+Value* Liveness::getDefinedValue(Instruction* instruction)
+{
+	if (ResultInstruction* resultInst = dynamic_cast<ResultInstruction*>(instruction))
+		return resultInst->getResult();
+	else if (DeclarationInstruction* declInst = dynamic_cast<DeclarationInstruction*>(instruction))
+		return declInst->getOperand();
+
+	return nullptr;
+}
+
+} // namespace ir
@@ -0,0 +1,46 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#ifndef IR_LIVENESS_H
+#define IR_LIVENESS_H
+
+#include <map>
+#include <set>
+#include "ir/function.h"
+
+namespace ir {
+
+/**
+ * Classic backward liveness analysis of named and temporary values of a single function.
+ * Besides live-in and live-out sets of basic blocks, set of values live right after
+ * each instruction is available.
+ */
+class Liveness
+{
+public:
+	Liveness();
+	~Liveness();
+
+	void run(Function* function);
+
+	const std::set<Value*>& getLiveIn(BasicBlock* basicBlock) const;
+	const std::set<Value*>& getLiveOut(BasicBlock* basicBlock) const;
+	const std::set<Value*>& getLiveAfter(Instruction* instruction) const;
+
+	bool isLiveAfter(Instruction* instruction, Value* value) const;
+
+	static bool isVariable(Value* value);
+	static Value* getDefinedValue(Instruction* instruction);
+
+private:
+	std::map<BasicBlock*, std::set<Value*>> _liveIn;
+	std::map<BasicBlock*, std::set<Value*>> _liveOut;
+	std::map<Instruction*, std::set<Value*>> _liveAfter;
+	std::set<Value*> _empty;
+};
+
+} // namespace ir
+
+#endif // IR_LIVENESS_H
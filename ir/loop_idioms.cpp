@@ -0,0 +1,257 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#include <algorithm>
+#include "ir/builder.h"
+#include "ir/instruction.h"
+#include "ir/loop_idioms.h"
+
+namespace ir {
+
+static bool isConstantOne(Value* value)
+{
+	return value->getType() == Value::Type::CONSTANT && value->getDataType() == Value::DataType::INT
+		&& static_cast<ConstantValue<int>*>(value)->getConstantValue() == 1;
+}
+
+static bool isConstantZero(Value* value)
+{
+	if (value->getType() != Value::Type::CONSTANT)
+		return false;
+
+	if (value->getDataType() == Value::DataType::CHAR)
+		return static_cast<ConstantValue<char>*>(value)->getConstantValue() == '\0';
+	else if (value->getDataType() == Value::DataType::INT)
+		return static_cast<ConstantValue<int>*>(value)->getConstantValue() == 0;
+
+	return false;
+}
+
+LoopIdioms::LoopIdioms() : _definitions(), _matched()
+{
+}
+
+LoopIdioms::~LoopIdioms()
+{
+}
+
+void LoopIdioms::run(Builder& builder)
+{
+	for (auto& pair : builder.getFunctions())
+	{
+		Function* function = pair.second;
+		std::vector<BasicBlock*> blocks = function->getBasicBlocks();
+		for (BasicBlock* bb : blocks)
+		{
+			// Body of the replaced loop is deleted
+			std::vector<BasicBlock*>& current = function->getBasicBlocks();
+			if (std::find(current.begin(), current.end(), bb) != current.end())
+				_replaceLoop(builder, function, bb);
+		}
+	}
+}
+
+bool LoopIdioms::_replaceLoop(Builder& builder, Function* function, BasicBlock* header)
+{
+	std::vector<Instruction*>& instructions = header->getInstructions();
+	if (instructions.empty())
+		return false;
+
+	CondJumpInstruction* condJumpInst = dynamic_cast<CondJumpInstruction*>(instructions.back());
+	if (condJumpInst == nullptr)
+		return false;
+
+	BasicBlock* body = condJumpInst->getTrueBasicBlock();
+	BasicBlock* exit = condJumpInst->getFalseBasicBlock();
+	if (body == header || exit == header || body == exit)
+		return false;
+
+	if (body->getPredecessors() != std::set<BasicBlock*>{ header } || body->getSuccessors() != std::set<BasicBlock*>{ header })
+		return false;
+
+	Value* index = _matchIncrement(body, header);
+	if (index == nullptr)
+		return false;
+
+	// Header may only compute the condition
+	_definitions.clear();
+	for (auto itr = instructions.begin(); itr + 1 != instructions.end(); ++itr)
+	{
+		ResultInstruction* resultInst = dynamic_cast<ResultInstruction*>(*itr);
+		if (resultInst == nullptr || resultInst->getResult() == nullptr || resultInst->getResult()->getType() != Value::Type::TEMPORARY)
+			return false;
+
+		_definitions[resultInst->getResult()] = *itr;
+	}
+
+	std::string functionName;
+	std::vector<Value*> arguments;
+	_matched.clear();
+	if (_matchScan(condJumpInst->getCondition(), index, arguments))
+		functionName = "str_scan";
+	else if (_matched.clear(), _matchFind(condJumpInst->getCondition(), index, arguments))
+		functionName = "str_find";
+	else if (_matched.clear(), _matchMismatch(condJumpInst->getCondition(), index, arguments))
+		functionName = "str_mismatch";
+	else
+		return false;
+
+	if (_matched.size() + 1 != instructions.size())
+		return false;
+
+	for (auto& inst : instructions)
+		delete inst;
+	instructions.clear();
+
+	Value* result = builder.createTemporaryValue(Value::DataType::INT);
+	instructions.push_back(new BuiltinCallInstruction(result, functionName, arguments));
+	instructions.push_back(new AssignInstruction(index, result));
+	instructions.push_back(new JumpInstruction(exit));
+	header->addDef(index);
+
+	header->getPredecessors().erase(body);
+	header->getSuccessors().erase(body);
+	std::vector<BasicBlock*>& blocks = function->getBasicBlocks();
+	blocks.erase(std::remove(blocks.begin(), blocks.end(), body), blocks.end());
+	delete body;
+	return true;
+}
+
+Value* LoopIdioms::_matchIncrement(BasicBlock* body, BasicBlock* header)
+{
+	// %t = add i, 1
+	// i = %t
+	// jump header
+	std::vector<Instruction*>& instructions = body->getInstructions();
+	if (instructions.size() != 3)
+		return nullptr;
+
+	AddInstruction* addInst = dynamic_cast<AddInstruction*>(instructions[0]);
+	AssignInstruction* assignInst = dynamic_cast<AssignInstruction*>(instructions[1]);
+	JumpInstruction* jumpInst = dynamic_cast<JumpInstruction*>(instructions[2]);
+	if (addInst == nullptr || assignInst == nullptr || jumpInst == nullptr || jumpInst->getFollowingBasicBlock() != header)
+		return nullptr;
+
+	Value* index = assignInst->getResult();
+	if (index->getType() != Value::Type::NAMED || assignInst->getOperand() != addInst->getResult())
+		return nullptr;
+
+	if ((addInst->getLeftOperand() == index && isConstantOne(addInst->getRightOperand()))
+			|| (addInst->getRightOperand() == index && isConstantOne(addInst->getLeftOperand())))
+		return index;
+
+	return nullptr;
+}
+
+bool LoopIdioms::_matchScan(Value* condition, Value* index, std::vector<Value*>& arguments)
+{
+	// get_at(s, i) != c
+	NotEqualInstruction* notEqualInst = dynamic_cast<NotEqualInstruction*>(_matchDefinition(condition));
+	if (notEqualInst == nullptr)
+		return false;
+
+	Value* left = notEqualInst->getLeftOperand();
+	Value* right = notEqualInst->getRightOperand();
+	for (int swap = 0; swap < 2; ++swap, std::swap(left, right))
+	{
+		if (right->getType() == Value::Type::TEMPORARY || right == index)
+			continue;
+
+		Value* str = _matchGetAt(left, index);
+		if (str == nullptr)
+			continue;
+
+		arguments = { str, index, right };
+		return true;
+	}
+
+	return false;
+}
+
+bool LoopIdioms::_matchFind(Value* condition, Value* index, std::vector<Value*>& arguments)
+{
+	// get_at(s, i) != c && get_at(s, i) != '\0'
+	AndInstruction* andInst = dynamic_cast<AndInstruction*>(_matchDefinition(condition));
+	if (andInst == nullptr)
+		return false;
+
+	std::vector<Value*> leftArguments, rightArguments;
+	if (!_matchScan(andInst->getLeftOperand(), index, leftArguments) || !_matchScan(andInst->getRightOperand(), index, rightArguments))
+		return false;
+
+	if (leftArguments[0] != rightArguments[0])
+		return false;
+
+	if (isConstantZero(leftArguments[2]))
+		arguments = rightArguments;
+	else if (isConstantZero(rightArguments[2]))
+		arguments = leftArguments;
+	else
+		return false;
+
+	return true;
+}
+
+bool LoopIdioms::_matchMismatch(Value* condition, Value* index, std::vector<Value*>& arguments)
+{
+	// get_at(a, i) == get_at(b, i) && get_at(a, i) != '\0'
+	AndInstruction* andInst = dynamic_cast<AndInstruction*>(_matchDefinition(condition));
+	if (andInst == nullptr)
+		return false;
+
+	Instruction* left = _matchDefinition(andInst->getLeftOperand());
+	Instruction* right = _matchDefinition(andInst->getRightOperand());
+	EqualInstruction* equalInst = dynamic_cast<EqualInstruction*>(left);
+	NotEqualInstruction* notEqualInst = dynamic_cast<NotEqualInstruction*>(right);
+	if (equalInst == nullptr || notEqualInst == nullptr)
+	{
+		equalInst = dynamic_cast<EqualInstruction*>(right);
+		notEqualInst = dynamic_cast<NotEqualInstruction*>(left);
+	}
+	if (equalInst == nullptr || notEqualInst == nullptr)
+		return false;
+
+	Value* str1 = _matchGetAt(equalInst->getLeftOperand(), index);
+	Value* str2 = _matchGetAt(equalInst->getRightOperand(), index);
+	if (str1 == nullptr || str2 == nullptr)
+		return false;
+
+	// Both strings have the same character there, so it does not matter which one is tested
+	Value* tested = nullptr;
+	if (isConstantZero(notEqualInst->getRightOperand()))
+		tested = _matchGetAt(notEqualInst->getLeftOperand(), index);
+	else if (isConstantZero(notEqualInst->getLeftOperand()))
+		tested = _matchGetAt(notEqualInst->getRightOperand(), index);
+	if (tested != str1 && tested != str2)
+		return false;
+
+	arguments = { str1, str2, index };
+	return true;
+}
+
+Value* LoopIdioms::_matchGetAt(Value* value, Value* index)
+{
+	BuiltinCallInstruction* builtinInst = dynamic_cast<BuiltinCallInstruction*>(_matchDefinition(value));
+	if (builtinInst == nullptr || builtinInst->getFunctionName() != "get_at" || builtinInst->getArguments()[1] != index)
+		return nullptr;
+
+	Value* str = builtinInst->getArguments()[0];
+	if (str->getType() == Value::Type::TEMPORARY)
+		return nullptr;
+
+	return str;
+}
+
+Instruction* LoopIdioms::_matchDefinition(Value* value)
+{
+	auto itr = _definitions.find(value);
+	if (itr == _definitions.end())
+		return nullptr;
+
+	_matched.insert(itr->second);
+	return itr->second;
+}
+
+} // namespace ir
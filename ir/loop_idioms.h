@@ -0,0 +1,49 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#ifndef IR_LOOP_IDIOMS_H
+#define IR_LOOP_IDIOMS_H
+
+#include <map>
+#include <set>
+#include <vector>
+#include "ir/optimizer.h"
+
+namespace ir {
+
+/**
+ * Replaces character scanning loops with calls of runtime routines. Recognized loops
+ * consist of a header testing characters at index i and a body only incrementing i:
+ *
+ *   while (get_at(s, i) != c) { i = i + 1; }                                      str_scan
+ *   while (get_at(s, i) != c && get_at(s, i) != '\0') { i = i + 1; }              str_find
+ *   while (get_at(a, i) == get_at(b, i) && get_at(a, i) != '\0') { i = i + 1; }  str_mismatch
+ *
+ * Header then computes the final index at once and jumps out of the loop, body is removed.
+ */
+class LoopIdioms : public Pass
+{
+public:
+	LoopIdioms();
+	virtual ~LoopIdioms();
+
+	virtual void run(Builder& builder) override;
+
+private:
+	bool _replaceLoop(Builder& builder, Function* function, BasicBlock* header);
+	Value* _matchIncrement(BasicBlock* body, BasicBlock* header);
+	bool _matchScan(Value* condition, Value* index, std::vector<Value*>& arguments);
+	bool _matchFind(Value* condition, Value* index, std::vector<Value*>& arguments);
+	bool _matchMismatch(Value* condition, Value* index, std::vector<Value*>& arguments);
+	Value* _matchGetAt(Value* value, Value* index);
+	Instruction* _matchDefinition(Value* value);
+
+	std::map<Value*, Instruction*> _definitions;
+	std::set<Instruction*> _matched;
+};
+
+} // namespace ir
+
+#endif // IR_LOOP_IDIOMS_H
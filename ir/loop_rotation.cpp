@@ -0,0 +1,200 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#include "ir/builder.h"
+#include "ir/instruction.h"
+#include "ir/loop_rotation.h"
+
+namespace ir {
+
+// Conditions are copied, so the longer ones are left alone to keep the code small
+static const size_t MaxConditionSize = 16;
+
+template <typename T>
+static Instruction* cloneBinary(Instruction* instruction, Value* result)
+{
+	T* inst = dynamic_cast<T*>(instruction);
+	return inst != nullptr ? new T(result, inst->getLeftOperand(), inst->getRightOperand()) : nullptr;
+}
+
+template <typename T>
+static Instruction* cloneUnary(Instruction* instruction, Value* result)
+{
+	T* inst = dynamic_cast<T*>(instruction);
+	return inst != nullptr ? new T(result, inst->getOperand()) : nullptr;
+}
+
+static Instruction* cloneLoadIndexed(Instruction* instruction, Value* result)
+{
+	LoadIndexedInstruction* inst = dynamic_cast<LoadIndexedInstruction*>(instruction);
+	return inst != nullptr ? new LoadIndexedInstruction(result, inst->getArray(), inst->getIndex()) : nullptr;
+}
+
+static Instruction* cloneCall(Instruction* instruction, Value* result)
+{
+	CallInstruction* inst = dynamic_cast<CallInstruction*>(instruction);
+	return inst != nullptr ? new CallInstruction(result, inst->getFunction(), inst->getArguments()) : nullptr;
+}
+
+static Instruction* cloneBuiltinCall(Instruction* instruction, Value* result)
+{
+	BuiltinCallInstruction* inst = dynamic_cast<BuiltinCallInstruction*>(instruction);
+	return inst != nullptr ? new BuiltinCallInstruction(result, inst->getFunctionName(), inst->getArguments()) : nullptr;
+}
+
+LoopRotation::LoopRotation()
+{
+}
+
+LoopRotation::~LoopRotation()
+{
+}
+
+void LoopRotation::run(Builder& builder)
+{
+	for (auto& pair : builder.getFunctions())
+	{
+		for (BasicBlock* bb : pair.second->getBasicBlocks())
+			_rotateLoop(builder, bb);
+	}
+}
+
+bool LoopRotation::_rotateLoop(Builder& builder, BasicBlock* header)
+{
+	std::vector<Instruction*>& instructions = header->getInstructions();
+	if (instructions.empty() || instructions.size() > MaxConditionSize)
+		return false;
+
+	CondJumpInstruction* condJumpInst = dynamic_cast<CondJumpInstruction*>(instructions.back());
+	if (condJumpInst == nullptr)
+		return false;
+
+	BasicBlock* body = condJumpInst->getTrueBasicBlock();
+	BasicBlock* exit = condJumpInst->getFalseBasicBlock();
+	if (body == header || exit == header || body == exit)
+		return false;
+
+	// Header may only compute the condition
+	for (auto itr = instructions.begin(); itr + 1 != instructions.end(); ++itr)
+	{
+		ResultInstruction* resultInst = dynamic_cast<ResultInstruction*>(*itr);
+		if (resultInst == nullptr || resultInst->getResult() == nullptr || resultInst->getResult()->getType() != Value::Type::TEMPORARY)
+			return false;
+	}
+
+	// Loop has to be entered only by the jump from the preheader
+	std::set<BasicBlock*> loop = _findLoop(header, body);
+	BasicBlock* preheader = nullptr;
+	bool backEdge = false;
+	for (BasicBlock* pred : header->getPredecessors())
+	{
+		if (loop.find(pred) != loop.end())
+			backEdge = true;
+		else if (preheader == nullptr)
+			preheader = pred;
+		else
+			return false;
+	}
+
+	if (preheader == nullptr || !backEdge)
+		return false;
+
+	JumpInstruction* jumpInst = dynamic_cast<JumpInstruction*>(preheader->getTerminalInstruction());
+	if (jumpInst == nullptr || jumpInst->getFollowingBasicBlock() != header)
+		return false;
+
+	std::map<Value*, Value*> temporaries;
+	std::vector<Instruction*> guard;
+	for (Instruction* inst : instructions)
+	{
+		Instruction* clone = _clone(builder, inst, temporaries);
+		if (clone == nullptr)
+		{
+			for (Instruction* cloned : guard)
+				delete cloned;
+			return false;
+		}
+		guard.push_back(clone);
+	}
+
+	std::vector<Instruction*>& preInstructions = preheader->getInstructions();
+	delete jumpInst;
+	preInstructions.pop_back();
+	for (Instruction* inst : guard)
+	{
+		for (Value* operand : getInstructionOperands(inst))
+		{
+			if (operand->getType() == Value::Type::NAMED)
+				preheader->addUse(operand);
+		}
+		preInstructions.push_back(inst);
+	}
+
+	preheader->getSuccessors().erase(header);
+	header->getPredecessors().erase(preheader);
+	preheader->addSuccessor(body);
+	preheader->addSuccessor(exit);
+	body->addPredecessor(preheader);
+	exit->addPredecessor(preheader);
+	return true;
+}
+
+std::set<BasicBlock*> LoopRotation::_findLoop(BasicBlock* header, BasicBlock* body)
+{
+	// Blocks reachable from the body without passing the header
+	std::set<BasicBlock*> loop;
+	std::vector<BasicBlock*> stack = { body };
+	while (!stack.empty())
+	{
+		BasicBlock* bb = stack.back();
+		stack.pop_back();
+		if (bb == header || !loop.insert(bb).second)
+			continue;
+
+		stack.insert(stack.end(), bb->getSuccessors().begin(), bb->getSuccessors().end());
+	}
+
+	return loop;
+}
+
+Instruction* LoopRotation::_clone(Builder& builder, Instruction* instruction, std::map<Value*, Value*>& temporaries)
+{
+	if (CondJumpInstruction* condJumpInst = dynamic_cast<CondJumpInstruction*>(instruction))
+	{
+		Value* condition = condJumpInst->getCondition();
+		if (temporaries.find(condition) != temporaries.end())
+			condition = temporaries[condition];
+		return new CondJumpInstruction(condition, condJumpInst->getTrueBasicBlock(), condJumpInst->getFalseBasicBlock());
+	}
+
+	static Instruction* (*const cloners[])(Instruction*, Value*) = {
+		cloneBinary<AddInstruction>, cloneBinary<SubtractInstruction>, cloneBinary<MultiplyInstruction>,
+		cloneBinary<DivideInstruction>, cloneBinary<ModuloInstruction>, cloneBinary<LessInstruction>,
+		cloneBinary<LessEqualInstruction>, cloneBinary<GreaterInstruction>, cloneBinary<GreaterEqualInstruction>,
+		cloneBinary<EqualInstruction>, cloneBinary<NotEqualInstruction>, cloneBinary<AndInstruction>,
+		cloneBinary<OrInstruction>, cloneBinary<BitwiseAndInstruction>, cloneBinary<BitwiseOrInstruction>,
+		cloneBinary<BitwiseXorInstruction>, cloneBinary<ShiftLeftInstruction>, cloneBinary<ShiftRightInstruction>,
+		cloneUnary<NotInstruction>, cloneUnary<TypecastInstruction>, cloneUnary<BitwiseNotInstruction>,
+		cloneUnary<NegInstruction>, cloneLoadIndexed, cloneCall, cloneBuiltinCall
+	};
+
+	Value* result = dynamic_cast<ResultInstruction*>(instruction)->getResult();
+	Value* newResult = builder.createTemporaryValue(result->getDataType());
+	for (auto cloner : cloners)
+	{
+		Instruction* clone = cloner(instruction, newResult);
+		if (clone == nullptr)
+			continue;
+
+		for (auto& pair : temporaries)
+			replaceInstructionOperand(clone, pair.first, pair.second);
+		temporaries[result] = newResult;
+		return clone;
+	}
+
+	return nullptr;
+}
+
+} // namespace ir
@@ -0,0 +1,44 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#ifndef IR_LOOP_ROTATION_H
+#define IR_LOOP_ROTATION_H
+
+#include <map>
+#include <set>
+#include "ir/optimizer.h"
+
+namespace ir {
+
+/**
+ * Rotates while and for loops into guarded do-while loops. Loop is entered by a jump
+ * to its header, which only computes the condition and jumps to the body or out:
+ *
+ *   pre:    ...; jump header               pre:    ...; cond'; cjump body, exit
+ *   header: cond; cjump body, exit    =>   header: cond; cjump body, exit
+ *   body:   ...; jump header               body:   ...; jump header
+ *
+ * The copy of the condition in the preheader guards the first iteration, so the header
+ * is entered only from the end of the body and it can be laid out right behind it.
+ * The back edge is then the conditional jump of the header. The condition is evaluated
+ * the same number of times as before, so even conditions with calls may be copied.
+ */
+class LoopRotation : public Pass
+{
+public:
+	LoopRotation();
+	virtual ~LoopRotation();
+
+	virtual void run(Builder& builder) override;
+
+private:
+	bool _rotateLoop(Builder& builder, BasicBlock* header);
+	std::set<BasicBlock*> _findLoop(BasicBlock* header, BasicBlock* body);
+	Instruction* _clone(Builder& builder, Instruction* instruction, std::map<Value*, Value*>& temporaries);
+};
+
+} // namespace ir
+
+#endif // IR_LOOP_ROTATION_H
@@ -0,0 +1,47 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#include "ir/constant_folding.h"
+#include "ir/in_place_update.h"
+#include "ir/loop_idioms.h"
+#include "ir/loop_rotation.h"
+#include "ir/optimizer.h"
+#include "ir/print_decomposition.h"
+#include "ir/print_merging.h"
+
+namespace ir {
+
+Pass::Pass()
+{
+}
+
+Pass::~Pass()
+{
+}
+
+Optimizer::Optimizer(bool ropeStrings) : _passes()
+{
+	_passes.push_back(new ConstantFolding());
+	_passes.push_back(new LoopIdioms());
+	_passes.push_back(new LoopRotation());
+	_passes.push_back(new PrintDecomposition());
+	_passes.push_back(new PrintMerging());
+	// Depends on liveness, so it has to be the last one
+	_passes.push_back(new InPlaceUpdate(ropeStrings));
+}
+
+Optimizer::~Optimizer()
+{
+	for (auto& pass : _passes)
+		delete pass;
+}
+
+void Optimizer::run(Builder& builder)
+{
+	for (auto& pass : _passes)
+		pass->run(builder);
+}
+
+} // namespace ir
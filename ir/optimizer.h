@@ -0,0 +1,44 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#ifndef IR_OPTIMIZER_H
+#define IR_OPTIMIZER_H
+
+#include <vector>
+#include "ir/builder.h"
+
+namespace ir {
+
+/**
+ * Transformation of the IR of the whole program.
+ */
+class Pass
+{
+public:
+	Pass();
+	virtual ~Pass();
+
+	virtual void run(Builder& builder) = 0;
+};
+
+/**
+ * Runs all optimization passes over the IR, in the order they were registered.
+ * With rope strings, strcat results may share memory with its operands.
+ */
+class Optimizer
+{
+public:
+	Optimizer(bool ropeStrings = false);
+	~Optimizer();
+
+	void run(Builder& builder);
+
+private:
+	std::vector<Pass*> _passes;
+};
+
+} // namespace ir
+
+#endif // IR_OPTIMIZER_H
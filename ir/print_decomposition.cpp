@@ -0,0 +1,115 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#include <algorithm>
+#include "ir/instruction.h"
+#include "ir/print_decomposition.h"
+
+namespace ir {
+
+PrintDecomposition::PrintDecomposition() : _useCount(), _definitions(), _decomposed()
+{
+}
+
+PrintDecomposition::~PrintDecomposition()
+{
+}
+
+void PrintDecomposition::run(Builder& builder)
+{
+	for (auto& pair : builder.getFunctions())
+	{
+		_useCount.clear();
+		for (BasicBlock* bb : pair.second->getBasicBlocks())
+		{
+			for (Instruction* inst : bb->getInstructions())
+			{
+				for (Value* operand : getInstructionOperands(inst))
+					_useCount[operand]++;
+			}
+		}
+
+		for (BasicBlock* bb : pair.second->getBasicBlocks())
+			_decomposePrints(bb);
+	}
+}
+
+void PrintDecomposition::_decomposePrints(BasicBlock* basicBlock)
+{
+	std::vector<Instruction*>& instructions = basicBlock->getInstructions();
+
+	_definitions.clear();
+	_decomposed.clear();
+	for (Instruction* inst : instructions)
+	{
+		BuiltinCallInstruction* builtinInst = dynamic_cast<BuiltinCallInstruction*>(inst);
+		if (builtinInst != nullptr && builtinInst->getFunctionName() == "print")
+		{
+			std::vector<Value*> args;
+			for (Value* arg : builtinInst->getArguments())
+				_decompose(arg, args);
+			builtinInst->getArguments() = args;
+			continue;
+		}
+
+		if (builtinInst != nullptr && builtinInst->getFunctionName() == "strcat" && builtinInst->getResult() != nullptr)
+			_definitions[builtinInst->getResult()] = inst;
+		else if (TypecastInstruction* castInst = dynamic_cast<TypecastInstruction*>(inst))
+		{
+			if (castInst->getOperand()->getDataType() == Value::DataType::CHAR && castInst->getResult()->getDataType() == Value::DataType::STRING)
+				_definitions[castInst->getResult()] = inst;
+		}
+
+		// Operands of the definitions must hold the same value when they are printed
+		Value* changed = nullptr;
+		if (AssignInstruction* assignInst = dynamic_cast<AssignInstruction*>(inst))
+			changed = assignInst->getResult();
+		else if (DeclarationInstruction* declInst = dynamic_cast<DeclarationInstruction*>(inst))
+			changed = declInst->getOperand();
+
+		if (changed == nullptr)
+			continue;
+
+		for (auto itr = _definitions.begin(); itr != _definitions.end(); )
+		{
+			std::vector<Value*> operands = getInstructionOperands(itr->second);
+			if (std::find(operands.begin(), operands.end(), changed) != operands.end())
+				itr = _definitions.erase(itr);
+			else
+				++itr;
+		}
+	}
+
+	for (auto& inst : instructions)
+	{
+		if (_decomposed.find(inst) == _decomposed.end())
+			continue;
+
+		delete inst;
+		inst = nullptr;
+	}
+
+	instructions.erase(std::remove(instructions.begin(), instructions.end(), nullptr), instructions.end());
+}
+
+void PrintDecomposition::_decompose(Value* arg, std::vector<Value*>& parts)
+{
+	auto itr = _definitions.find(arg);
+	if (arg->getType() != Value::Type::TEMPORARY || itr == _definitions.end() || _useCount[arg] != 1)
+	{
+		parts.push_back(arg);
+		return;
+	}
+
+	// Operands of strcat are printed one after another, char is printed as it is.
+	// Operands are now used by print instead of the definition, so use counts stay the same
+	Instruction* definition = itr->second;
+	_decomposed.insert(definition);
+	_definitions.erase(itr);
+	for (Value* operand : getInstructionOperands(definition))
+		_decompose(operand, parts);
+}
+
+} // namespace ir
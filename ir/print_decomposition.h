@@ -0,0 +1,39 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#ifndef IR_PRINT_DECOMPOSITION_H
+#define IR_PRINT_DECOMPOSITION_H
+
+#include <map>
+#include <set>
+#include "ir/optimizer.h"
+
+namespace ir {
+
+/**
+ * Replaces print arguments created by strcat or char to string typecast, which are
+ * not used anywhere else, with the operands of these instructions. String is then
+ * never created on the heap, print just outputs its parts one after another.
+ */
+class PrintDecomposition : public Pass
+{
+public:
+	PrintDecomposition();
+	virtual ~PrintDecomposition();
+
+	virtual void run(Builder& builder) override;
+
+private:
+	void _decomposePrints(BasicBlock* basicBlock);
+	void _decompose(Value* arg, std::vector<Value*>& parts);
+
+	std::map<Value*, unsigned int> _useCount;
+	std::map<Value*, Instruction*> _definitions;
+	std::set<Instruction*> _decomposed;
+};
+
+} // namespace ir
+
+#endif // IR_PRINT_DECOMPOSITION_H
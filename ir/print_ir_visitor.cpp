@@ -140,7 +140,13 @@ void PrintIrVisitor::visit(DeclarationInstruction* instr)
 	_os << Indentation;
 	_os << "declare ";
 	instr->getOperand()->accept(*this);
-	_os << ":" << Value::dataTypeToString(instr->getOperand()->getDataType()) << "\n";
+	_os << ":" << Value::dataTypeToString(instr->getOperand()->getDataType());
+	if (NamedValue* namedValue = dynamic_cast<NamedValue*>(instr->getOperand()))
+	{
+		if (namedValue->isArray())
+			_os << "[" << namedValue->getArraySize() << "]";
+	}
+	_os << "\n";
 }
 
 void PrintIrVisitor::visit(JumpInstruction* instr)
@@ -195,11 +201,43 @@ void PrintIrVisitor::visit(BuiltinCallInstruction* instr)
 		_os << " = ";
 	}
 	_os << "builtin-call " << instr->getFunctionName();
+	if (instr->getInPlace() == BuiltinCallInstruction::InPlace::ALWAYS)
+		_os << " in-place";
+	else if (instr->getInPlace() == BuiltinCallInstruction::InPlace::HEAP_ONLY)
+		_os << " in-place-if-heap";
 	for (Value* arg : instr->getArguments())
 	{
 		_os << ", ";
 		arg->accept(*this);
 	}
+	if (instr->getAppendEnd() != nullptr)
+	{
+		_os << ", append-end ";
+		instr->getAppendEnd()->accept(*this);
+	}
+	_os << "\n";
+}
+
+void PrintIrVisitor::visit(LoadIndexedInstruction* instr)
+{
+	_os << Indentation;
+	instr->getResult()->accept(*this);
+	_os << " = load-indexed ";
+	instr->getArray()->accept(*this);
+	_os << ", ";
+	instr->getIndex()->accept(*this);
+	_os << "\n";
+}
+
+void PrintIrVisitor::visit(StoreIndexedInstruction* instr)
+{
+	_os << Indentation;
+	_os << "store-indexed ";
+	instr->getArray()->accept(*this);
+	_os << ", ";
+	instr->getIndex()->accept(*this);
+	_os << ", ";
+	instr->getValue()->accept(*this);
 	_os << "\n";
 }
 
@@ -368,6 +406,39 @@ void PrintIrVisitor::visit(BitwiseOrInstruction* instr)
 	_os << "\n";
 }
 
+void PrintIrVisitor::visit(BitwiseXorInstruction* instr)
+{
+	_os << Indentation;
+	instr->getResult()->accept(*this);
+	_os << " = bitwise xor ";
+	instr->getLeftOperand()->accept(*this);
+	_os << ", ";
+	instr->getRightOperand()->accept(*this);
+	_os << "\n";
+}
+
+void PrintIrVisitor::visit(ShiftLeftInstruction* instr)
+{
+	_os << Indentation;
+	instr->getResult()->accept(*this);
+	_os << " = shift left ";
+	instr->getLeftOperand()->accept(*this);
+	_os << ", ";
+	instr->getRightOperand()->accept(*this);
+	_os << "\n";
+}
+
+void PrintIrVisitor::visit(ShiftRightInstruction* instr)
+{
+	_os << Indentation;
+	instr->getResult()->accept(*this);
+	_os << " = shift right ";
+	instr->getLeftOperand()->accept(*this);
+	_os << ", ";
+	instr->getRightOperand()->accept(*this);
+	_os << "\n";
+}
+
 void PrintIrVisitor::visit(NotInstruction* instr)
 {
 	_os << Indentation;
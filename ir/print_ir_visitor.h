@@ -33,6 +33,8 @@ public:
 	virtual void visit(ReturnInstruction* instr) override;
 	virtual void visit(CallInstruction* instr) override;
 	virtual void visit(BuiltinCallInstruction* instr) override;
+	virtual void visit(LoadIndexedInstruction* instr) override;
+	virtual void visit(StoreIndexedInstruction* instr) override;
 	virtual void visit(AddInstruction* instr) override;
 	virtual void visit(SubtractInstruction* instr) override;
 	virtual void visit(MultiplyInstruction* instr) override;
@@ -48,6 +50,9 @@ public:
 	virtual void visit(OrInstruction* instr) override;
 	virtual void visit(BitwiseAndInstruction* instr) override;
 	virtual void visit(BitwiseOrInstruction* instr) override;
+	virtual void visit(BitwiseXorInstruction* instr) override;
+	virtual void visit(ShiftLeftInstruction* instr) override;
+	virtual void visit(ShiftRightInstruction* instr) override;
 	virtual void visit(NotInstruction* instr) override;
 	virtual void visit(TypecastInstruction* instr) override;
 	virtual void visit(BitwiseNotInstruction* instr) override;
@@ -0,0 +1,139 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#include <algorithm>
+#include "ir/instruction.h"
+#include "ir/print_merging.h"
+
+namespace ir {
+
+PrintMerging::PrintMerging()
+{
+}
+
+PrintMerging::~PrintMerging()
+{
+}
+
+void PrintMerging::run(Builder& builder)
+{
+	for (auto& pair : builder.getFunctions())
+	{
+		for (BasicBlock* bb : pair.second->getBasicBlocks())
+		{
+			_mergePrints(bb);
+			for (Instruction* inst : bb->getInstructions())
+			{
+				if (BuiltinCallInstruction* printInst = asPrint(inst))
+					_foldConstantArguments(builder, printInst);
+			}
+		}
+	}
+}
+
+void PrintMerging::_mergePrints(BasicBlock* basicBlock)
+{
+	std::vector<Instruction*>& instructions = basicBlock->getInstructions();
+
+	// Arguments of the pending print are moved to the following one, since arguments
+	// of the following print may not be computed yet at the place of the pending one
+	BuiltinCallInstruction* pendingPrint = nullptr;
+	for (auto& inst : instructions)
+	{
+		if (BuiltinCallInstruction* printInst = asPrint(inst))
+		{
+			if (pendingPrint != nullptr)
+			{
+				std::vector<Value*>& args = printInst->getArguments();
+				args.insert(args.begin(), pendingPrint->getArguments().begin(), pendingPrint->getArguments().end());
+
+				auto pendingItr = std::find(instructions.begin(), instructions.end(), pendingPrint);
+				delete *pendingItr;
+				*pendingItr = nullptr;
+			}
+
+			pendingPrint = printInst;
+		}
+		else if (pendingPrint != nullptr && _isBarrier(inst, pendingPrint))
+			pendingPrint = nullptr;
+	}
+
+	instructions.erase(std::remove(instructions.begin(), instructions.end(), nullptr), instructions.end());
+}
+
+void PrintMerging::_foldConstantArguments(Builder& builder, BuiltinCallInstruction* instruction)
+{
+	std::vector<Value*>& args = instruction->getArguments();
+	std::vector<Value*> foldedArgs;
+	for (std::size_t i = 0; i < args.size(); )
+	{
+		// Find the longest run of constants which can be written as a string literal
+		std::string text;
+		std::size_t end = i;
+		for (; end < args.size() && args[end]->getType() == Value::Type::CONSTANT; ++end)
+		{
+			if (args[end]->getDataType() == Value::DataType::INT)
+				text += std::to_string(static_cast<ConstantValue<int>*>(args[end])->getConstantValue());
+			else if (args[end]->getDataType() == Value::DataType::CHAR)
+			{
+				char c = static_cast<ConstantValue<char>*>(args[end])->getConstantValue();
+				if (!canEscapeChar(c))
+					break;
+
+				text += escapeStringConstant(std::string(1, c));
+			}
+			else
+				text += static_cast<ConstantValue<std::string>*>(args[end])->getConstantValue();
+		}
+
+		if (end - i < 2)
+		{
+			// Nothing to join, keep the argument as it is
+			end = std::max(end, i + 1);
+			foldedArgs.insert(foldedArgs.end(), args.begin() + i, args.begin() + end);
+		}
+		else if (!text.empty())
+			foldedArgs.push_back(builder.createConstantValue(text));
+
+		i = end;
+	}
+
+	args = foldedArgs;
+}
+
+bool PrintMerging::_isBarrier(Instruction* instruction, BuiltinCallInstruction* pendingPrint) const
+{
+	if (BuiltinCallInstruction* builtinInst = dynamic_cast<BuiltinCallInstruction*>(instruction))
+	{
+		const std::string& name = builtinInst->getFunctionName();
+		return name == "read_char" || name == "read_int" || name == "read_string";
+	}
+	else if (dynamic_cast<CallInstruction*>(instruction))
+	{
+		// Callee may run for a long time or never return, output printed before it has to appear first
+		return true;
+	}
+
+	// Printed variables can't change before the arguments are evaluated
+	Value* changed = nullptr;
+	if (AssignInstruction* assignInst = dynamic_cast<AssignInstruction*>(instruction))
+		changed = assignInst->getResult();
+	else if (DeclarationInstruction* declInst = dynamic_cast<DeclarationInstruction*>(instruction))
+		changed = declInst->getOperand();
+
+	const std::vector<Value*>& args = pendingPrint->getArguments();
+	return changed != nullptr && std::find(args.begin(), args.end(), changed) != args.end();
+}
+
+BuiltinCallInstruction* PrintMerging::asPrint(Instruction* instruction)
+{
+	BuiltinCallInstruction* builtinInst = dynamic_cast<BuiltinCallInstruction*>(instruction);
+	if (builtinInst == nullptr || builtinInst->getFunctionName() != "print")
+		return nullptr;
+
+	return builtinInst;
+}
+
+} // namespace ir
@@ -0,0 +1,36 @@
+/**
+ * Project VYPe 2015/2016
+ * Marek Milkovič (xmilko01) & Oliver Nemček (xnemce03)
+ **/
+
+#ifndef IR_PRINT_MERGING_H
+#define IR_PRINT_MERGING_H
+
+#include "ir/optimizer.h"
+
+namespace ir {
+
+/**
+ * Merges print calls in the same basic block into the last one of them, as long as
+ * nothing in between reads the input, calls a function or changes the printed variables.
+ * Adjacent constant arguments of print are then joined into a single string constant.
+ */
+class PrintMerging : public Pass
+{
+public:
+	PrintMerging();
+	virtual ~PrintMerging();
+
+	virtual void run(Builder& builder) override;
+
+private:
+	void _mergePrints(BasicBlock* basicBlock);
+	void _foldConstantArguments(Builder& builder, BuiltinCallInstruction* instruction);
+	bool _isBarrier(Instruction* instruction, BuiltinCallInstruction* pendingPrint) const;
+
+	static BuiltinCallInstruction* asPrint(Instruction* instruction);
+};
+
+} // namespace ir
+
+#endif // IR_PRINT_MERGING_H
@@ -58,7 +58,7 @@ void Value::setDataType(Value::DataType dataType)
 	_dataType = dataType;
 }
 
-NamedValue::NamedValue(Value::DataType dataType, const std::string& name) : Value(Value::Type::NAMED, dataType), _name(name)
+NamedValue::NamedValue(Value::DataType dataType, const std::string& name) : Value(Value::Type::NAMED, dataType), _name(name), _arraySize(0)
 {
 }
 
@@ -81,6 +81,21 @@ void NamedValue::setName(const std::string& name)
 	_name = name;
 }
 
+int NamedValue::getArraySize() const
+{
+	return _arraySize;
+}
+
+void NamedValue::setArraySize(int arraySize)
+{
+	_arraySize = arraySize;
+}
+
+bool NamedValue::isArray() const
+{
+	return _arraySize > 0;
+}
+
 uint64_t TemporaryValue::TemporaryIdPool = 0;
 
 TemporaryValue::TemporaryValue(Value::DataType dataType) : Value(Value::Type::TEMPORARY, dataType), _temporaryId(TemporaryIdPool++)
@@ -141,4 +156,51 @@ template class ConstantValue<int>;
 template class ConstantValue<char>;
 template class ConstantValue<std::string>;
 
+std::string escapeStringConstant(const std::string& text)
+{
+	std::string escaped;
+	for (char c : text)
+	{
+		switch (c)
+		{
+			case '\'': escaped += "\\'"; break;
+			case '\"': escaped += "\\\""; break;
+			case '\\': escaped += "\\\\"; break;
+			case '\t': escaped += "\\t"; break;
+			case '\n': escaped += "\\n"; break;
+			default: escaped += c; break;
+		}
+	}
+
+	return escaped;
+}
+
+std::string unescapeStringConstant(const std::string& text)
+{
+	std::string unescaped;
+	for (std::size_t i = 0; i < text.length(); ++i)
+	{
+		if (text[i] != '\\' || i + 1 == text.length())
+		{
+			unescaped += text[i];
+			continue;
+		}
+
+		switch (text[++i])
+		{
+			case 't': unescaped += '\t'; break;
+			case 'n': unescaped += '\n'; break;
+			default: unescaped += text[i]; break;
+		}
+	}
+
+	return unescaped;
+}
+
+bool canEscapeChar(char c)
+{
+	// Only printable characters and those which lexer is able to escape
+	return (c >= ' ' && c <= '~') || c == '\t' || c == '\n';
+}
+
 } // namespace ir
@@ -63,8 +63,18 @@ public:
 	const std::string& getName() const;
 	void setName(const std::string& name);
 
+	/**
+	 * Number of elements if the value is a local array of its data type, 0 otherwise.
+	 * Arrays are never held in registers, their elements are only accessed through
+	 * LoadIndexedInstruction and StoreIndexedInstruction.
+	 */
+	int getArraySize() const;
+	void setArraySize(int arraySize);
+	bool isArray() const;
+
 private:
 	std::string _name;
+	int _arraySize;
 };
 
 class TemporaryValue : public Value
@@ -101,6 +111,15 @@ private:
 	ConstantType _value;
 };
 
+/**
+ * String constants hold the text as it was written in the source code, including
+ * escape sequences, so it can be emitted into the assembly directly. These convert
+ * between this form and the actual characters of the string.
+ */
+std::string escapeStringConstant(const std::string& text);
+std::string unescapeStringConstant(const std::string& text);
+bool canEscapeChar(char c);
+
 } // namespace ir
 
 #endif // IR_VALUE_H
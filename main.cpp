@@ -6,10 +6,12 @@
 #include <iostream>
 #include <fstream>
 #include <cstdarg>
+#include <vector>
 
 #include "frontend/ast.h"
 #include "frontend/context.h"
 #include "backend/asmgenerator.h"
+#include "ir/optimizer.h"
 
 // Have to be included last
 #include "frontend/c_parser.h"
@@ -43,14 +45,30 @@ void yyerror(const char *s, ...)
 int main(int argc, char** argv)
 {
 	std::string outputFileName = "out.asm";
+	bool ropeStrings = false;
+	bool delaySlots = false;
 	yyin = nullptr;
-	if (argc == 2)
+
+	// Options may precede the input and output file names
+	std::vector<std::string> args;
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i];
+		if (arg == "--rope-strings")
+			ropeStrings = true;
+		else if (arg == "--delay-slots")
+			delaySlots = true;
+		else
+			args.push_back(arg);
+	}
+
+	if (args.size() == 1)
 	{
 		;
 	}
-	else if (argc == 3)
+	else if (args.size() == 2)
 	{
-		outputFileName = argv[2];
+		outputFileName = args[1];
 	}
 	else
 	{
@@ -60,7 +78,7 @@ int main(int argc, char** argv)
 	}
 
 	//yydebug = 1;
-	yyin = fopen(argv[1], "r");
+	yyin = fopen(args[0].c_str(), "r");
 	if (yyin == nullptr)
 	{
 		exitCode = 5;
@@ -129,8 +147,11 @@ int main(int argc, char** argv)
 	ir::Builder builder;
 	program.generateIr(builder);
 
+	ir::Optimizer optimizer(ropeStrings);
+	optimizer.run(builder);
+
 	std::ofstream outputFile(outputFileName, std::ios::trunc | std::ios::out);
-	backend::ASMgenerator generator;
+	backend::ASMgenerator generator(ropeStrings, delaySlots);
 	generator.translateIR(builder);
 
 	//std::cout << builder.codeText() << std::endl;
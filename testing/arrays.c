@@ -0,0 +1,98 @@
+int count_primes(int limit)
+{
+	char composite[2000];
+	int i = 0;
+	while (i < limit) {
+		composite[i] = (char)0;
+		i = i + 1;
+	}
+	int count = 0;
+	i = 2;
+	while (i < limit) {
+		if (composite[i] == (char)0) {
+			count = count + 1;
+			int j = i * i;
+			while (j < limit) {
+				composite[j] = (char)1;
+				j = j + i;
+			}
+		} else {}
+		i = i + 1;
+	}
+	return count;
+}
+
+int lcs(string a, string b)
+{
+	int table[1089];
+	int n = strlen(a), m = strlen(b), i, j;
+	for (i = 0; i <= n; i = i + 1) {
+		for (j = 0; j <= m; j = j + 1) {
+			if (i == 0 || j == 0) {
+				table[i * 33 + j] = 0;
+			} else {
+				if (get_at(a, i - 1) == get_at(b, j - 1)) {
+					table[i * 33 + j] = table[(i - 1) * 33 + j - 1] + 1;
+				} else {
+					int up = table[(i - 1) * 33 + j], left = table[i * 33 + j - 1];
+					if (up > left) {
+						table[i * 33 + j] = up;
+					} else {
+						table[i * 33 + j] = left;
+					}
+				}
+			}
+		}
+	}
+	return table[n * 33 + m];
+}
+
+int main(void)
+{
+	int histogram[26], fib[10], big[9000];
+	int i;
+	for (i = 0; i < 26; i = i + 1) {
+		histogram[i] = 0;
+	}
+	string text = read_string();
+	for (i = 0; i < strlen(text); i = i + 1) {
+		char c = get_at(text, i);
+		if (c >= 'a' && c <= 'z') {
+			histogram[(int)c - (int)'a'] = histogram[(int)c - (int)'a'] + 1;
+		} else {}
+	}
+	for (i = 0; i < 26; i = i + 1) {
+		if (histogram[i] != 0) {
+			print((char)((int)'a' + i), ':', histogram[i], ' ');
+		} else {}
+	}
+	print('\n');
+
+	fib[0] = 0;
+	fib[1] = 1;
+	for (i = 2; i < 10; i = i + 1) {
+		fib[i] = fib[i - 1] + fib[i - 2];
+	}
+	print(fib[9], ' ', fib[5] * fib[6], '\n');
+
+	char word[5];
+	word[0] = 'v';
+	word[1] = 'y';
+	word[2] = 'p';
+	word[3] = 'e';
+	word[4] = '!';
+	string s = "";
+	for (i = 0; i < 5; i = i + 1) {
+		s = strcat(s, (string)word[i]);
+	}
+	print(s, '\n');
+
+	big[0] = 7;
+	big[8999] = 11;
+	i = 8999;
+	print(big[0] + big[i], '\n');
+
+	print(count_primes(2000), ' ', count_primes(100), '\n');
+	print(lcs("dynamic programming", "table driven algorithm"), '\n');
+	return 0;
+}
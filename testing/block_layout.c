@@ -0,0 +1,55 @@
+int find(int n, int key)
+{
+	int i, j;
+	for (i = 0; i < n; i = i + 1) {
+		for (j = 0; j < n; j = j + 1) {
+			if (i * n + j == key) {
+				return i * 100 + j;
+			} else {}
+		}
+	}
+	return -1;
+}
+
+int collatz(int x)
+{
+	int steps = 0;
+	while (x != 1) {
+		if (x % 2 == 0) {
+			x = x / 2;
+		} else {
+			x = 3 * x + 1;
+		}
+		steps = steps + 1;
+	}
+	return steps;
+}
+
+void pattern(int n)
+{
+	int i = 0;
+	while (i < n) {
+		if (i < 2) {
+			print('a');
+		} else {
+			if (i < 4) {
+				print('b');
+			} else {
+				print('c');
+			}
+		}
+		i = i + 1;
+	}
+	print('\n');
+}
+
+int main(void)
+{
+	int n = read_int(), i;
+	for (i = 0; i < n; i = i + 1) {
+		int x = read_int();
+		print(find(x, x + 3), ' ', find(x, x * x), ' ', collatz(x), '\n');
+		pattern(x);
+	}
+	return 0;
+}
@@ -57,6 +57,10 @@ string set_at(string str, int pos, char ch) {
 
 string strcat(const string& first, const string& second) { return first + second; }
 
+int strlen(const string& str) { return str.length(); }
+
+string substr(const string& str, int pos, int len) { return str.substr(pos, len); }
+
 " > tmp/"$1".c
 	cat "$1".c >> tmp/"$1".c
 
@@ -0,0 +1,50 @@
+int sum6(int a, int b, int c, int d, int e, int f)
+{
+	return a + 2 * b + 3 * c + 4 * d + 5 * e + 6 * f;
+}
+
+int sum5(int a, int b, int c, int d, int e)
+{
+	return sum6(e, d, c, b, a, 1) - sum6(a, b, c, d, e, 0);
+}
+
+string word(string s, int n)
+{
+	if (n > 0) {
+		return strcat(word(s, n - 1), s);
+	} else {}
+	return "<";
+}
+
+int walk(int n, int a, int b, int c, int d, int e)
+{
+	if (n == 0) {
+		return a + b + c + d + e;
+	} else {}
+	return walk(n - 1, e, a, b, c, d + n) * 2;
+}
+
+int main(void)
+{
+	int i, total = 0;
+	int values[8];
+	string s;
+	int x = read_int();
+	i = 0;
+	while (i < 8) {
+		values[i] = sum6(i, x, i, x, i, x);
+		i = i + 1;
+	}
+	i = 0;
+	while (i < 7) {
+		s = word("ab", i);
+		print(s, ' ', strlen(s), '\n');
+		total = total + sum5(values[i], values[i + 1], i, x, strlen(s));
+		values[i] = total;
+		i = i + 1;
+	}
+	print(total, '\n');
+	print(values[0], ' ', values[6], ' ', values[7], '\n');
+	print(walk(x, 1, 2, 3, 4, 5), '\n');
+	return 0;
+}
@@ -0,0 +1,36 @@
+int id(int x)
+{
+	return x;
+}
+
+int main(void)
+{
+	int n = read_int(), i, j;
+	for (i = 0; i < n; i = i + 1) {
+		int a = read_int(), b = read_int();
+		print(!(a < b), !(a <= b), !(a > b), !(a >= b), !(a == b), !(a != b), ' ');
+		print(!(a >= 5), !(a > 5), !(a <= -5), !!a, !a, ' ');
+		print(a < b && b < 10, a <= b || a == 3, (a < b) & (b > 0), (a == b) | (a > 0), (a != b) ^ (b != 0), ' ');
+		print(a && b, a || b, a && b > 2, a < 0 || b, !(a && b) || !(a || b), ' ');
+		print((a + 1 < b - 1) + (id(a) < id(b)) * 2 + (a - id(b) >= 0) * 4, ' ');
+		print(a + (b & 15) - (a | 3) + (a ^ b), '\n');
+
+		j = 0;
+		if (!(a < b)) { j = j + 1; } else {}
+		if (!(a <= b)) { j = j + 2; } else {}
+		if (!(a == b)) { j = j + 4; } else {}
+		if (!(a != b)) { j = j + 8; } else {}
+		if (!(a >= 0)) { j = j + 16; } else {}
+		if (!(a > 0)) { j = j + 32; } else {}
+		if (a <= b) { j = j + 64; } else {}
+		if (a >= b) { j = j + 128; } else {}
+		if (a > 7) { j = j + 256; } else {}
+		if (a >= 7) { j = j + 512; } else {}
+		if (0 >= a) { j = j + 1024; } else {}
+		if (a < b && !(b < 0)) { j = j + 2048; } else {}
+		if (!a) { j = j + 4096; } else {}
+		if (a - b) { j = j + 8192; } else {}
+		print(j, '\n');
+	}
+	return 0;
+}
@@ -0,0 +1,29 @@
+int digitSum(int x)
+{
+	int sum = 0;
+	if (x < 0) {
+		x = -x;
+	} else {}
+	while (x != 0) {
+		sum = sum + x % 10;
+		x = x / 10;
+	}
+	return sum;
+}
+
+void printRow(int x)
+{
+	print(x * 0, ' ', x * 1, ' ', x * -1, ' ', x * 2, ' ', 3 * x, ' ', x * 7, ' ', x * 10, ' ', x * -10, ' ', x * 12, ' ', x * 1000, '\n');
+	print(x / 1, ' ', x / 2, ' ', x / -2, ' ', x / 4, ' ', x / 8, ' ', x / 3, ' ', x / -3, ' ', x / 5, ' ', x / 7, ' ', x / 10, ' ', x / -10, ' ', x / 1000, ' ', x / 65536, ' ', x / 641, ' ', x / 2147483647, '\n');
+	print(x % 1, ' ', x % -1, ' ', x % 2, ' ', x % -2, ' ', x % 8, ' ', x % 65536, ' ', x % 131072, ' ', x % 3, ' ', x % 10, ' ', x % -10, ' ', x % 7, ' ', x % 12, ' ', x % 641, ' ', x % 1000, '\n');
+}
+
+int main(void)
+{
+	int n = read_int(), i;
+	for (i = 0; i < n; i = i + 1) {
+		printRow(read_int());
+	}
+	print(digitSum(read_int()), ' ', digitSum(-2147483647), ' ', 2147483647 * 3, ' ', -2147483647 / 7, '\n');
+	return 0;
+}
@@ -0,0 +1,49 @@
+int collatz(int n)
+{
+	int steps = 0;
+	while (n != 1) {
+		if (n % 2 == 0) {
+			n = n / 2;
+		} else {
+			n = 3 * n + 1;
+		}
+		steps = steps + 1;
+	}
+	return steps;
+}
+
+int pick(int a, int b, int c)
+{
+	if (a < b) {
+		if (b < c) {
+			return c;
+		} else {}
+		return b;
+	} else {}
+	return a;
+}
+
+void count(string s, char c)
+{
+	int i = 0, n = 0, len = strlen(s);
+	while (i < len) {
+		if (get_at(s, i) == c) {
+			n = n + 1;
+		} else {}
+		i = i + 1;
+	}
+	print(n, '\n');
+}
+
+int main(void)
+{
+	string word = read_string();
+	int n = read_int(), i, best = 0;
+	for (i = 1; i <= n; i = i + 1) {
+		best = pick(best, collatz(i), i + best % 3);
+	}
+	print(best, '\n');
+	count("mississippi", 's');
+	count(word, 'a');
+	return 0;
+}
@@ -0,0 +1,7 @@
+int main(void)
+{
+	int table[131073];
+	table[0] = 1;
+	print(table[0]);
+	return 0;
+}
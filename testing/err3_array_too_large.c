@@ -0,0 +1,7 @@
+int main(void)
+{
+	int huge[1000000000];
+	huge[0] = 1;
+	print(huge[0]);
+	return 0;
+}
@@ -0,0 +1,6 @@
+int main(void)
+{
+	int counts[4];
+	int total = counts;
+	return 0;
+}
@@ -0,0 +1,19 @@
+int sum(void)
+{
+	char first[300000];
+	int i = 0, total = 0;
+	while (i < 10) {
+		char second[300000];
+		first[i] = (char)i;
+		second[i] = first[i];
+		total = total + (int)second[i];
+		i = i + 1;
+	}
+	return total;
+}
+
+int main(void)
+{
+	print(sum());
+	return 0;
+}
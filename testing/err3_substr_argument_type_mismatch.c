@@ -0,0 +1,6 @@
+int main(void)
+{
+	string s = "hello";
+	string t = substr(s, 1, 'c');
+	return 0;
+}
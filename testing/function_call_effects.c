@@ -0,0 +1,47 @@
+int sum6(int a, int b, int c, int d, int e, int f)
+{
+	return a + b + c + d + e + f;
+}
+
+int fib(int n)
+{
+	if (n < 2) {return n;} else {}
+	return fib(n - 1) + fib(n - 2);
+}
+
+string twice(string s)
+{
+	return strcat(s, s);
+}
+
+int countTwice(string s, int n)
+{
+	string t = twice(s);
+	int i = 0;
+	int cnt = 0;
+	while (get_at(t, i) > ' ') {
+		cnt = cnt + 1;
+		i = i + 1;
+	}
+	return cnt + n;
+}
+
+int report(string label, int value)
+{
+	print(label, value, '\n');
+	return value;
+}
+
+int main(void)
+{
+	string a = "ab";
+	string b = twice(a);
+	int x = sum6(1, 2, 3, 4, 5, fib(10));
+	int y = countTwice(b, x);
+	string c = twice("xy");
+	report("sum6 = ", x);
+	report("countTwice = ", y);
+	print(a, " ", b, " ", c, '\n');
+	print(sum6(countTwice("q", 0), 1, 1, 1, 1, report("inner = ", 7)), '\n');
+	return 0;
+}
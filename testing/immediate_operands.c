@@ -0,0 +1,49 @@
+int sign(int x)
+{
+	if (x < 0) {
+		return -1;
+	} else {}
+	if (0 < x) {
+		return 1;
+	} else {}
+	return 0;
+}
+
+int classify(int x)
+{
+	int r = 0;
+	if (x <= 0) { r = r + 1; } else {}
+	if (x >= 0) { r = r + 2; } else {}
+	if (0 >= x) { r = r + 4; } else {}
+	if (x == 0) { r = r + 8; } else {}
+	if (x != 7) { r = r + 16; } else {}
+	if (100 == x) { r = r + 32; } else {}
+	return r;
+}
+
+int main(void)
+{
+	int n = read_int(), i;
+	for (i = 0; i < n; i = i + 1) {
+		int x = read_int();
+		print(x + 1, ' ', x - 1, ' ', 5 - x, ' ', x + 32767, ' ', x - 32768, ' ', x + 32768, ' ', x - 32769, ' ', x - -2147483647, '\n');
+		print(x & 255, ' ', 65535 & x, ' ', x & 65536, ' ', x & -2, ' ', x | 16, ' ', x | 65535, ' ', x | 65536, ' ', x ^ 65535, ' ', x ^ -1, '\n');
+		print(x < 100, ' ', x <= 100, ' ', x > 100, ' ', x >= 100, ' ', x < -32768, ' ', x <= 32767, ' ', x > 32767, ' ', x >= -32768, ' ', 100 < x, ' ', -5 >= x, '\n');
+		print(x <= 2147483647, ' ', x > 2147483647, ' ', x >= -2147483647 - 1, ' ', x < 0, ' ', x >= 0, ' ', 0 <= x, '\n');
+		print(x == 0, ' ', x != 0, ' ', x == 100, ' ', x != -100, ' ', x == 32768, ' ', x == 65535, ' ', x != 65536, ' ', 7 == x, '\n');
+		print(sign(x), ' ', classify(x), '\n');
+	}
+
+	string s = "hello World 2016 vype, ~{}";
+	int letters = 0, digits = 0;
+	for (i = 0; i < strlen(s); i = i + 1) {
+		char c = get_at(s, i);
+		if (c >= 'a') {
+			if (c <= 'z') { letters = letters + 1; } else {}
+		} else {}
+		if ('0' <= c && c <= '9') { digits = digits + 1; } else {}
+		if (c == ' ') { print('_'); } else { print(c); }
+	}
+	print('\n', letters, ' ', digits, '\n');
+	return 0;
+}
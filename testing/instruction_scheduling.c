@@ -0,0 +1,22 @@
+int mix(int a, int b, int c)
+{
+	int p = a * b, q = c / 7, r = c % 5, s;
+	s = p - q * r;
+	print(p, ' ', q, ' ', r, ' ', s, '\n');
+	return s / (r + 1) + a * c;
+}
+
+int main(void)
+{
+	string word = read_string();
+	int a = read_int(), b = read_int(), c = read_int(), i, acc = 1;
+	print(mix(a, b, c), '\n');
+	i = read_int() * a;
+	print(i, ' ', read_int() / b, '\n');
+	for (i = 1; i < 8; i = i + 1) {
+		acc = acc * i + c / i - b % i;
+		print(acc, ',');
+	}
+	print('\n', strcat(word, "!"), ' ', get_at(word, 0), '\n');
+	return 0;
+}
@@ -0,0 +1,72 @@
+int clamp(int x, int lo, int hi)
+{
+	if (x < lo) {
+		return lo;
+	} else {}
+	if (x > hi) {
+		return hi;
+	} else {}
+	return x;
+}
+
+int mix4(int a, int b, int c, int d)
+{
+	int s = a + b, t = c - d, u = a * d, v = b % 7, w;
+	w = s * t - u + v;
+	if (w < 0) {
+		w = -w;
+	} else {}
+	return w;
+}
+
+int five(int a, int b, int c, int d, int e)
+{
+	return a - b + c - d + e;
+}
+
+int gcd(int a, int b)
+{
+	while (b != 0) {
+		int t = b;
+		b = a % b;
+		a = t;
+	}
+	return a;
+}
+
+int pressure(int n)
+{
+	int a = n + 1, b = n + 2, c = n + 3, d = n + 4, e = n + 5, f = n + 6;
+	int g = a * b + c * d, h = e * f + a * c, i = b * d + e * a;
+	return (a + b) * (c + d) * (e + f) - (g + h) * i + (a - f) * (b - e) * (c - d);
+}
+
+void show(char c, int times)
+{
+	while (times > 0) {
+		print(c);
+		times = times - 1;
+	}
+	print('\n');
+}
+
+int fact(int n)
+{
+	if (n < 2) {
+		return 1;
+	} else {}
+	return n * fact(n - 1);
+}
+
+int main(void)
+{
+	int n = read_int(), i, sum = 0;
+	for (i = -3; i < n; i = i + 1) {
+		sum = sum + clamp(i * 3, -4, 10) + gcd(i * 12 + 60, 18);
+	}
+	print(sum, '\n');
+	print(mix4(n, 3, 9, 2), ' ', mix4(-n, 12, 1, 20), '\n');
+	print(five(1, 2, 3, 4, n), ' ', pressure(n), ' ', fact(n), '\n');
+	show('#', n);
+	return 0;
+}
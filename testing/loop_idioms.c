@@ -0,0 +1,65 @@
+int length(string s)
+{
+	int i = 0;
+	while (get_at(s, i) != get_at("", 0)) {
+		i = i + 1;
+	}
+	return i;
+}
+
+int find(string s, char c, int from)
+{
+	int i = from;
+	while (get_at(s, i) != c && get_at(s, i) != get_at("", 0)) {
+		i = i + 1;
+	}
+	return i;
+}
+
+int skip(string s, char c)
+{
+	int i = 0;
+	while (c != get_at(s, i)) {
+		i = i + 1;
+	}
+	return i;
+}
+
+int compare(string a, string b)
+{
+	int i = 0;
+	while (get_at(a, i) == get_at(b, i) && get_at(b, i) != get_at("", 0)) {
+		i = i + 1;
+	}
+	return (int)get_at(a, i) - (int)get_at(b, i);
+}
+
+int common(string a, string b)
+{
+	int i = 0;
+	while (get_at(a, i) != get_at("", 0) && get_at(a, i) == get_at(b, i)) {
+		i = i + 1;
+	}
+	return i;
+}
+
+int main(void)
+{
+	string line = read_string();
+	string empty = "";
+	string built = strcat(line, "0123456789abcdefghij");
+	print(length(line), " ", length(empty), " ", length(built), " ", length(strcat("x", built)), '\n');
+	print(find(line, 'o', 0), " ", find(line, 'o', 5), " ", find(line, '?', 0), '\n');
+	print(skip(built, 'j'), " ", skip("tab\there", '\t'), '\n');
+	print(compare(line, line), " ", compare("abc", "abd"), " ", compare("ab", "abc"), " ", compare(line, "hello"), '\n');
+	print(common(line, "hello there"), " ", common("", line), '\n');
+
+	int i = 2;
+	int steps = 0;
+	while (get_at(line, i) != ' ') {
+		i = i + 1;
+		steps = steps + 1;
+	}
+	print(i, " ", steps, '\n');
+	return 0;
+}
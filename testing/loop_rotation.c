@@ -0,0 +1,53 @@
+int next(int x)
+{
+	print('.');
+	return x - 1;
+}
+
+int firstSquareAbove(int limit)
+{
+	int i;
+	for (i = 0; ; i = i + 1) {
+		if (i * i > limit) {
+			return i;
+		} else {}
+	}
+	return -1;
+}
+
+int main(void)
+{
+	int n = read_int(), x, total = 0, i, j;
+	while (read_int() != 0) {
+		total = total + 1;
+	}
+	print(total, '\n');
+
+	for (i = 0; i < n; i = i + 1) {
+		for (j = i; j > 0; j = j - 1) {
+			print('*');
+		}
+		print('|');
+	}
+	print('\n');
+
+	x = 5;
+	while (next(x) > 0) {
+		x = x - 1;
+	}
+	print(x, '\n');
+
+	for (i = 10; i < 0; i = i + 1) {
+		print("never\n");
+	}
+
+	string s = "rotated loops";
+	int spaces = 0;
+	for (i = 0; i < strlen(s); i = i + 1) {
+		if (get_at(s, i) == ' ') {
+			spaces = spaces + 1;
+		} else {}
+	}
+	print(spaces, ' ', firstSquareAbove(50), '\n');
+	return 0;
+}
@@ -0,0 +1,10 @@
+int main(void)
+{
+	int max = read_int(), min = read_int(), one = read_int(), five = read_int();
+	print(max + one, ' ', max + 1, ' ', 1 + max, '\n');
+	print(min - one, ' ', min - 1, '\n');
+	print(min - five, ' ', min - 5, ' ', min + -5, '\n');
+	print(max - -five, ' ', max + 5, '\n');
+	print(max + one == max + 1, ' ', min - five == min - 5, '\n');
+	return 0;
+}
@@ -0,0 +1,44 @@
+int big(int x)
+{
+	int a = x + 100000;
+	int b = x - 100000;
+	int c = 100000;
+	int d = 100000 - x;
+	return a + b + c + d;
+}
+
+int chain(int x)
+{
+	int y = x;
+	int z = y;
+	y = z + 1;
+	z = y;
+	return z * 2 + y;
+}
+
+int pick(int x, int y)
+{
+	if (x == y) {
+		return 0;
+	} else {
+		if (x < y) {
+			return -1;
+		} else {}
+	}
+	return 1;
+}
+
+int main(void)
+{
+	int n = read_int(), i;
+	for (i = 0; i < n; i = i + 1) {
+		int x = read_int();
+		int y = read_int();
+		print(big(x), ' ', chain(x), ' ', pick(x, y), ' ', pick(y, x), '\n');
+		while (x > y) {
+			x = x - 3;
+		}
+		print(x, ' ', x == y, ' ', x != 1000000, ' ', 1000000 - x, '\n');
+	}
+	return 0;
+}
@@ -0,0 +1,22 @@
+string greet(string name)
+{
+	return strcat("Hello, ", name);
+}
+
+int main(void)
+{
+	string a = "foo";
+	string b = "bar";
+	char c = get_at(b, 1);
+	char nl = '\n';
+	string ab = strcat(a, b);
+
+	print(strcat(a, b), nl);
+	print(strcat(strcat(a, (string)c), strcat("-", b)), (string)nl);
+	print(ab, " ", strcat(ab, ab), (string)get_at(a, 0), '\n');
+	print(greet(strcat(a, "!")), nl);
+	print(strcat(greet(b), strcat((string)'?', (string)c)), nl);
+	a = strcat(a, "x");
+	print(strcat(a, a), " ", a, nl);
+	return 0;
+}
@@ -0,0 +1,38 @@
+int shout(int x)
+{
+	print("shout ", x, '\n');
+	return x * 2;
+}
+
+int quiet(int x)
+{
+	return x + 1;
+}
+
+int main(void)
+{
+	int x = 42;
+	char c = 'z';
+	print("x = ", x, '\n');
+	print("constants: ", 1, ' ', -7, ' ', 'a', '\t', "\"q\"", '\n');
+	print("c = ", c);
+	print('\n');
+	x = quiet(x);
+	print("after quiet ", x, '\n');
+	print("before shout ");
+	x = shout(x);
+	print("after shout ", x, '\n');
+	print("old x ", x);
+	x = 5;
+	print(" new x ", x, '\n');
+	print("reading: ");
+	x = read_int();
+	print(x, '\n', 0, "", "", 10, '\\', '\n');
+	if (x > 3) {
+		print("big");
+	} else {
+		print("small");
+	}
+	print('\n');
+	return 0;
+}
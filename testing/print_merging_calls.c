@@ -0,0 +1,38 @@
+int spin(int n)
+{
+	int i = 0, acc = 0;
+	while (i < n) {
+		acc = acc + i % 7;
+		i = i + 1;
+	}
+	return acc;
+}
+
+int countdown(int n)
+{
+	if (n == 0) {
+		return 0;
+	} else {}
+	return countdown(n - 1) + 1;
+}
+
+int ask(void)
+{
+	return read_int();
+}
+
+int main(void)
+{
+	int x;
+	print("prompt before a long call: ");
+	spin(2000);
+	print("done\n");
+	print("recursion ");
+	x = countdown(300);
+	print("returned ", x, '\n');
+	print("value: ");
+	x = ask();
+	print(x, '\n');
+	print("nested ", spin(countdown(5)), '\n');
+	return 0;
+}
@@ -0,0 +1,52 @@
+int sub(int a, int b)
+{
+	print(a, '-', b, ' ');
+	return a - b;
+}
+
+int swapped(int a, int b, int c)
+{
+	int r = sub(b, a);
+	r = r + sub(c, b) * a;
+	return r + c;
+}
+
+int modified(int a, int b)
+{
+	a = a * 2;
+	b = sub(a, b) + b;
+	return a + b;
+}
+
+int fib(int n)
+{
+	if (n < 2) {
+		return n;
+	} else {}
+	return fib(n - 1) + fib(n - 2);
+}
+
+string tag(string s, int n, char c)
+{
+	string t = strcat(s, "#");
+	if (n > 0) {
+		return strcat(tag(t, n - 1, c), substr(s, 0, 1));
+	} else {}
+	return strcat(t, (string)c);
+}
+
+int many(int a, int b, int c, int d, int e, int f)
+{
+	return sub(f, a) + sub(e, b) + sub(d, c);
+}
+
+int main(void)
+{
+	int x = read_int();
+	print(swapped(x, 3, 10), '\n');
+	print(modified(x, 4), '\n');
+	print(fib(x + 5), '\n');
+	print(tag("ab", 3, 'z'), '\n');
+	print(many(1, 2, 3, 4, 5, x), '\n');
+	return 0;
+}
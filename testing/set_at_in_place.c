@@ -0,0 +1,47 @@
+string upper(string s)
+{
+	int i = 0;
+	char c = get_at(s, 0);
+	while (c != get_at("", 0)) {
+		if (c >= 'a' && c <= 'z') {
+			s = set_at(s, i, (char)((int)c - 32));
+		} else {}
+		i = i + 1;
+		c = get_at(s, i);
+	}
+	return s;
+}
+
+int main(void)
+{
+	string line = read_string();
+	string copy = line;
+	int i = 0;
+	while (i < 5) {
+		line = set_at(line, i, '*');
+		i = i + 1;
+	}
+	print(line, " ", copy, '\n');
+
+	string own = strcat(copy, "!");
+	i = 0;
+	while (i < 3) {
+		own = set_at(own, i, '#');
+		i = i + 1;
+	}
+	print(own, '\n');
+
+	string lit = "literal";
+	lit = set_at(lit, 0, 'L');
+	string lit2 = "literal";
+	print(lit, " ", lit2, " ", "literal", '\n');
+
+	string u = upper(copy);
+	print(u, " ", copy, '\n');
+	print(upper("mixed Case"), " ", upper(strcat("ab", read_string())), '\n');
+
+	string a = strcat("one", "two");
+	string b = set_at(a, 0, 'O');
+	print(a, " ", b, '\n');
+	return 0;
+}
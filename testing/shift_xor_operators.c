@@ -0,0 +1,36 @@
+int popcount(int x)
+{
+	int count = 0, i;
+	for (i = 0; i < 32; i = i + 1) {
+		count = count + ((x >> i) & 1);
+	}
+	return count;
+}
+
+int hash(string s)
+{
+	int h = 5381, i;
+	for (i = 0; i < strlen(s); i = i + 1) {
+		h = ((h << 5) + h) ^ (int)get_at(s, i);
+		h = h & 16777215;
+	}
+	return h;
+}
+
+int main(void)
+{
+	int a = read_int(), b = read_int();
+	print(a << 3, ' ', a >> 2, ' ', a ^ b, ' ', b ^ 255, ' ', 4660 ^ b, '\n');
+	print(-a >> 1, ' ', -a >> b, ' ', 1 << b, ' ', a << b >> 2, '\n');
+	print(1 + 2 << 3, ' ', 64 >> 1 + 1, ' ', 6 ^ 3 & 5, ' ', 8 | 2 ^ 3, '\n');
+	print(a ^ -1, ' ', a ^ 65535, ' ', a ^ 65536, '\n');
+	print('A' ^ ' ', ' ', popcount(a), ' ', popcount(-1), ' ', popcount(0), '\n');
+
+	int x = a, y = b;
+	x = x ^ y;
+	y = x ^ y;
+	x = x ^ y;
+	print(x, ' ', y, '\n');
+	print(hash("vype"), ' ', hash("shift and xor"), '\n');
+	return 0;
+}
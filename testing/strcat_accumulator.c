@@ -0,0 +1,77 @@
+string repeat(string s, int n)
+{
+	string result = "";
+	while (n > 0) {
+		result = strcat(result, s);
+		n = n - 1;
+	}
+	return result;
+}
+
+string join(string sep, int n)
+{
+	string out = "[";
+	int i = 0;
+	while (i < n) {
+		if (i > 0) {
+			out = strcat(out, sep);
+		} else {}
+		out = strcat(out, (string)(char)((int)'a' + i));
+		i = i + 1;
+	}
+	out = strcat(out, "]");
+	return out;
+}
+
+int main(void)
+{
+	string line = read_string();
+	string acc = "";
+	string snapshot = "";
+	string other = "";
+	int i = 0;
+	while (i < 6) {
+		acc = strcat(acc, line);
+		if (i == 2) {
+			snapshot = acc;
+		} else {}
+		if (i == 3) {
+			other = strcat("x", line);
+		} else {}
+		acc = strcat(acc, ",");
+		i = i + 1;
+	}
+	print(acc, '\n', snapshot, '\n', other, '\n');
+
+	acc = "";
+	i = 0;
+	while (i < 10) {
+		if (i == 5) {
+			acc = "reset:";
+		} else {}
+		acc = strcat(acc, (string)(char)((int)'0' + i));
+		i = i + 1;
+	}
+	print(acc, '\n');
+
+	string self = "ab";
+	i = 0;
+	while (i < 3) {
+		self = strcat(self, self);
+		i = i + 1;
+	}
+	print(self, '\n');
+
+	string r = repeat(line, 3);
+	string j = join("; ", 4);
+	print(r, '\n', j, '\n', repeat("-", 20), '\n');
+
+	string word = "";
+	char c = read_char();
+	while (c != '\n') {
+		word = strcat(word, (string)c);
+		c = read_char();
+	}
+	print(word, " ", line, '\n');
+	return 0;
+}
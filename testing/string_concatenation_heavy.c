@@ -0,0 +1,52 @@
+string wrap(string s, string left, string right)
+{
+	return strcat(left, strcat(s, right));
+}
+
+string first(string s)
+{
+	return s;
+}
+
+int main(void)
+{
+	string word = read_string();
+	string out = "";
+	string prefix = "";
+	int i = 0;
+	while (i < 20) {
+		out = strcat(out, word);
+		prefix = strcat((string)(char)((int)'a' + i), prefix);
+		i = i + 1;
+	}
+	print(out, '\n', prefix, '\n');
+
+	string both = strcat(strcat(prefix, "|"), strcat(out, "|"));
+	both = strcat(both, strcat(strcat("<", word), ">"));
+	print(both, '\n', get_at(both, 0), get_at(both, 21), get_at(both, 22), '\n');
+
+	string wrapped = wrap(wrap(word, "(", ")"), "[", "]");
+	print(wrapped, " ", first(wrapped), " ", first(strcat(word, word)), '\n');
+
+	string copy = both;
+	both = set_at(both, 0, 'Z');
+	print(get_at(both, 0), get_at(copy, 0), '\n');
+
+	string cmp1 = strcat("abc", word);
+	string cmp2 = strcat(strcat("ab", "c"), word);
+	if (cmp1 == cmp2 && !(cmp1 < cmp2) && cmp1 != strcat(cmp2, "!")) {
+		print("equal\n");
+	} else {
+		print("different\n");
+	}
+	print(strcat(cmp1, "") == "abcxy", " ", strcat("", strcat("", "")) == "", '\n');
+
+	string report = "";
+	i = 0;
+	while (i < 10) {
+		report = strcat(report, strcat(strcat("line ", (string)(char)((int)'0' + i)), ";"));
+		i = i + 1;
+	}
+	print(report, '\n');
+	return 0;
+}
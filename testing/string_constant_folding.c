@@ -0,0 +1,24 @@
+int main(void)
+{
+	string s = strcat("abc", "def");
+	string t = strcat(strcat("tab\t", "quote\" "), "back\\slash");
+	char c = get_at("hello", 1);
+	char end = get_at("hello", 5);
+	string u = set_at("hello", 0, 'j');
+	string v = set_at("a\'b", 1, '\n');
+	string w = (string)'x';
+	string q = strcat((string)'\'', (string)'\\');
+
+	print(s, '\n', t, '\n', c, '\n', u, v, w, '\n', q, '\n');
+	print((int)end, '\n');
+	print("abc" < strcat("abd", ""), "b" < strcat("abc", ""), "abc" <= strcat("abc", ""), "abc" > strcat("ab", ""), "" >= strcat("a", ""), '\n');
+	print("abc" == strcat("abc", ""), "abc" == strcat("ab", "c"), "x" != strcat("x", ""), "x" != strcat("y", ""), '\n');
+	print(get_at(strcat("wor", "ld"), 3), get_at(set_at("abc", 2, 'z'), 2), '\n');
+
+	int i = 0;
+	while ("stop" != strcat("st", "op") && i < 3) {
+		i = i + 1;
+	}
+	print(i, '\n');
+	return 0;
+}
@@ -0,0 +1,22 @@
+int check(string s)
+{
+	if (s == "quit") {return 1;} else {}
+	if ("help" == s) {return 2;} else {}
+	if (s == "") {return 3;} else {}
+	if (s != "longer than eight") {return 4;} else {}
+	return 5;
+}
+
+int main(void)
+{
+	string cmd = "";
+	int done = 0;
+	while (!done) {
+		cmd = read_string();
+		int r = check(cmd);
+		print(cmd, " -> ", r, ", ", cmd != "quit", cmd == "qu", cmd == "quitt", '\n');
+		if (r == 1) {done = 1;} else {}
+		if (r == 5) {print("eight ", cmd == "12345678", '\n');} else {}
+	}
+	return 0;
+}
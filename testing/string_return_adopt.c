@@ -0,0 +1,52 @@
+string pick(string a, string b, int first)
+{
+	if (first) {return a;} else {}
+	return b;
+}
+
+string label(int n)
+{
+	if (n < 0) {return "negative";} else {}
+	return "non-negative";
+}
+
+string orStar(string s, int star)
+{
+	if (star) {return strcat(s, "*");} else {}
+	return s;
+}
+
+string build(int n)
+{
+	if (n == 0) {return "";} else {}
+	return strcat(build(n - 1), (string)(char)(97 + n % 26));
+}
+
+string tail(int n, string s)
+{
+	if (n == 0) {return strcat(s, "!");} else {}
+	return tail(n - 1, s);
+}
+
+string wrap(string s)
+{
+	string tmp = strcat("<", s);
+	string res = strcat(tmp, ">");
+	return res;
+}
+
+int main(void)
+{
+	string a = "first";
+	string b = strcat("sec", "ond");
+	string p = pick(a, b, 0);
+	string q = pick(a, b, 1);
+	print(p, " ", q, " ", label(-1), " ", label(1), '\n');
+	print(orStar(b, 1), " ", orStar(b, 0), " ", b, '\n');
+	print(build(30), '\n');
+	string t = tail(50, wrap("x"));
+	string u = wrap(wrap(t));
+	print(t, " ", u, '\n');
+	print(wrap(orStar(pick(a, b, 1), 1)), '\n');
+	return 0;
+}
@@ -0,0 +1,40 @@
+string reverseWords(string s)
+{
+	string out = "";
+	int end = strlen(s);
+	int i = end - 1;
+	while (i >= 0) {
+		if (get_at(s, i) == ' ') {
+			out = strcat(out, substr(s, i + 1, end - i - 1));
+			out = strcat(out, " ");
+			end = i;
+		} else {}
+		i = i - 1;
+	}
+	out = strcat(out, substr(s, 0, end));
+	return out;
+}
+
+int main(void)
+{
+	string line = read_string();
+	print(strlen(line), " ", strlen(""), " ", strlen("four"), " ", strlen("tab\t"), '\n');
+	print(substr(line, 0, 5), "|", substr(line, 6, 100), "|", substr(line, 3, 0), "|", substr(line, strlen(line), 3), "|", '\n');
+	print(substr("constant", 2, 3), "|", substr("constant", 4, -1), "|", substr(line, 2, -1), "|", '\n');
+	print(reverseWords(line), '\n');
+
+	string half = substr(line, 0, strlen(line) / 2);
+	half = set_at(half, 0, 'J');
+	print(half, " ", line, '\n');
+	strlen(line);
+	substr(line, 1, 2);
+
+	int total = 0;
+	int i = 0;
+	while (i < 5) {
+		total = total + strlen(substr(line, i, 3));
+		i = i + 1;
+	}
+	print(total, '\n');
+	return 0;
+}